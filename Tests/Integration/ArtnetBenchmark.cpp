@@ -0,0 +1,113 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <Protocols/Artnet/ArtnetProtocol.hpp>
+
+#include <ossia/network/base/node.hpp>
+#include <ossia/network/base/parameter.hpp>
+#include <ossia/network/generic/generic_device.hpp>
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QHostAddress>
+#include <QUdpSocket>
+
+#include <wobjectimpl.h>
+
+#include <IscoreIntegrationTests.hpp>
+
+namespace
+{
+constexpr int universes = 4;
+constexpr int channels = universes * 512;
+
+std::vector<ossia::net::parameter_base*>
+dmxChannels(ossia::net::device_base& dev)
+{
+  std::vector<ossia::net::parameter_base*> params;
+  for (const auto& universe : dev.get_root_node().children())
+    for (const auto& channel : universe->children())
+      params.push_back(channel->get_parameter());
+  return params;
+}
+}
+
+class ArtnetBenchmark : public TestBase
+{
+  W_OBJECT(ArtnetBenchmark)
+
+public:
+  ArtnetBenchmark(int& argc, char** argv) : TestBase(argc, argv)
+  {
+  }
+
+private:
+  Engine::Network::ArtnetSpecificSettings settings() const
+  {
+    Engine::Network::ArtnetSpecificSettings set;
+    set.host = "127.0.0.1";
+    set.universes = universes;
+    set.rate = 44;
+    return set;
+  }
+
+  // Rate at which the execution can write DMX channels
+  void pushChannels()
+  {
+    ossia::net::generic_device dev{
+        std::make_unique<Engine::Network::ArtnetProtocol>(settings()),
+        "artnet"};
+    const auto params = dmxChannels(dev);
+    QCOMPARE(int(params.size()), channels);
+
+    constexpr int frames = 1000;
+    QElapsedTimer timer;
+    timer.start();
+    for (int f = 0; f < frames; f++)
+      for (int c = 0; c < channels; c++)
+        params[c]->push_value((f + c) % 256);
+    const auto ns = timer.nsecsElapsed();
+
+    qDebug() << channels << "channels:" << (frames * channels) / (ns / 1e9)
+             << "channels/s," << ns / double(frames * channels)
+             << "ns per channel";
+
+    QBENCHMARK
+    {
+      for (int c = 0; c < channels; c++)
+        params[c]->push_value(c % 256);
+    }
+  }
+  W_SLOT(pushChannels)
+
+  // The universes which changed are sent, with the values of their channels
+  void sendUniverses()
+  {
+    QUdpSocket socket;
+    if (!socket.bind(QHostAddress::LocalHost, 6454))
+      QSKIP("The Art-Net port is not available");
+
+    ossia::net::generic_device dev{
+        std::make_unique<Engine::Network::ArtnetProtocol>(settings()),
+        "artnet"};
+    const auto params = dmxChannels(dev);
+    params[512 + 9]->push_value(123);
+
+    bool received = false;
+    auto check = [&] {
+      while (socket.hasPendingDatagrams())
+      {
+        QByteArray packet(int(socket.pendingDatagramSize()), 0);
+        socket.readDatagram(packet.data(), packet.size());
+        if (packet.size() == 18 + 512 && packet.startsWith("Art-Net")
+            && uchar(packet[14]) == 1 && uchar(packet[18 + 9]) == 123)
+          received = true;
+      }
+      return received;
+    };
+    QTRY_VERIFY_WITH_TIMEOUT(check(), 2000);
+  }
+  W_SLOT(sendUniverses)
+};
+
+W_OBJECT_IMPL(ArtnetBenchmark)
+SCORE_INTEGRATION_TEST(ArtnetBenchmark)
@@ -0,0 +1,186 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <Process/Dataflow/Cable.hpp>
+#include <Process/Dataflow/CableItem.hpp>
+#include <Process/Dataflow/PortItem.hpp>
+#include <Process/DocumentPlugin.hpp>
+#include <Scenario/Commands/CommandAPI.hpp>
+#include <Scenario/Commands/Scenario/Creations/CreationMetaCommand.hpp>
+#include <Scenario/Document/Interval/IntervalModel.hpp>
+#include <Scenario/Document/ScenarioDocument/ScenarioDocumentModel.hpp>
+#include <Scenario/Process/ScenarioModel.hpp>
+
+#include <score/document/DocumentInterface.hpp>
+#include <score/plugins/documentdelegate/DocumentDelegateFactory.hpp>
+#include <score/plugins/documentdelegate/plugin/DocumentPluginCreator.hpp>
+#include <score/tools/IdentifierGeneration.hpp>
+
+#include <core/document/Document.hpp>
+#include <core/presenter/DocumentManager.hpp>
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QGraphicsRectItem>
+#include <QGraphicsScene>
+
+#include <wobjectimpl.h>
+
+#include <IscoreIntegrationTests.hpp>
+
+namespace
+{
+constexpr int processes = 50;
+}
+
+class CableBenchmark : public TestBase
+{
+  W_OBJECT(CableBenchmark)
+
+public:
+  CableBenchmark(int& argc, char** argv) : TestBase(argc, argv, true)
+  {
+  }
+
+private:
+  QGraphicsScene m_scene;
+  QGraphicsRectItem* m_root{};
+  std::vector<QGraphicsRectItem*> m_nodes;
+  std::vector<Dataflow::CableItem*> m_cables;
+  QObject m_cableModels;
+
+  // 50 processes whose outlets are each connected to all the inlets, laid
+  // out on a grid: 2500 cables.
+  void initTestCase()
+  {
+    auto& ctx = context();
+    ctx.docManager.newDocument(
+        ctx, Id<score::DocumentModel>{score::random_id_generator::getRandomId()},
+        *ctx.interfaces<score::DocumentDelegateList>().begin());
+    auto doc = ctx.docManager.currentDocument();
+    QVERIFY(doc);
+    auto& docctx = doc->context();
+    if (!docctx.findPlugin<Process::DocumentPlugin>())
+      score::addDocumentPlugin<Process::DocumentPlugin>(*doc);
+
+    auto& model
+        = score::IDocument::modelDelegate<Scenario::ScenarioDocumentModel>(
+            *doc);
+    const auto key = Metadata<ConcreteKey_k, Scenario::ProcessModel>::get();
+    std::vector<Scenario::ProcessModel*> procs;
+    {
+      using namespace Scenario::Command;
+      Macro m{new CreationMetaCommand, docctx};
+      for (int i = 0; i < processes; i++)
+        procs.push_back(safe_cast<Scenario::ProcessModel*>(
+            m.createProcess(model.baseInterval(), key, {})));
+      m.commit();
+    }
+
+    // Same item structure as the score: the cables are children of the
+    // common ancestor of their ports.
+    m_scene.setItemIndexMethod(QGraphicsScene::NoIndex);
+    m_root = new QGraphicsRectItem{0, 0, 5000, 5000};
+    m_scene.addItem(m_root);
+    for (int i = 0; i < processes; i++)
+    {
+      auto node = new QGraphicsRectItem{0, 0, 200, 100, m_root};
+      node->setPos(250. * (i % 10), 300. * (i / 10));
+      auto in = new Dataflow::PortItem{*procs[i]->inlet, docctx, node};
+      in->setPos(0, 50);
+      auto out = new Dataflow::PortItem{*procs[i]->outlet, docctx, node};
+      out->setPos(200, 50);
+      m_nodes.push_back(node);
+    }
+
+    int id = 0;
+    for (auto src : procs)
+    {
+      for (auto snk : procs)
+      {
+        Process::CableData data;
+        data.source = *src->outlet;
+        data.sink = *snk->inlet;
+        auto cable = new Process::Cable{Id<Process::Cable>{id++}, data,
+                                        &m_cableModels};
+        m_cables.push_back(new Dataflow::CableItem{*cable, docctx});
+      }
+    }
+    QCOMPARE(int(m_cables.size()), processes * processes);
+    QVERIFY(m_cables.front()->scene() == &m_scene);
+  }
+  W_SLOT(initTestCase)
+
+  void cleanupTestCase()
+  {
+    qDeleteAll(m_cables);
+    m_cables.clear();
+  }
+  W_SLOT(cleanupTestCase)
+
+  // Cost of the hit-testing done by the scene on each mouse move
+  void hitTest()
+  {
+    QElapsedTimer timer;
+    timer.start();
+    int hits = 0;
+    for (int x = 0; x < 2500; x += 25)
+      for (int y = 0; y < 1500; y += 50)
+        hits += m_scene.items(QPointF(x, y)).size();
+    const auto ms = timer.elapsed();
+    qDebug() << m_cables.size() << "cables: 3000 hit tests in" << ms << "ms,"
+             << hits << "items";
+
+    QBENCHMARK
+    {
+      m_scene.items(QPointF(1234, 567));
+    }
+  }
+  W_SLOT(hitTest)
+
+  void resize_data()
+  {
+    QTest::addColumn<bool>("moved");
+    QTest::newRow("unchanged") << false;
+    QTest::newRow("moved") << true;
+  }
+  W_SLOT(resize_data)
+
+  // Cost of a zoom, which resizes all the cables: only the ones whose ports
+  // moved recompute their path.
+  void resize()
+  {
+    QFETCH(bool, moved);
+    qreal dx = 10.;
+    QBENCHMARK
+    {
+      if (moved)
+      {
+        for (auto node : m_nodes)
+          node->moveBy(dx, 0.);
+        dx = -dx;
+      }
+      for (auto cable : m_cables)
+        cable->resize();
+    }
+  }
+  W_SLOT(resize)
+
+  // The cached geometry follows the ports
+  void geometryFollowsPorts()
+  {
+    auto cable = m_cables[1];
+    const auto before = cable->sceneBoundingRect();
+    cable->source()->parentItem()->moveBy(0., 40.);
+    cable->resize();
+    const auto after = cable->sceneBoundingRect();
+    cable->source()->parentItem()->moveBy(0., -40.);
+    cable->resize();
+
+    QVERIFY(before != after);
+    QCOMPARE(cable->sceneBoundingRect(), before);
+  }
+  W_SLOT(geometryFollowsPorts)
+};
+
+W_OBJECT_IMPL(CableBenchmark)
+SCORE_INTEGRATION_TEST(CableBenchmark)
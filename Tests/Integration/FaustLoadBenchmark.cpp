@@ -0,0 +1,111 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <Media/Effect/Faust/FaustFactoryCache.hpp>
+
+#include <QDebug>
+#include <QDir>
+#include <QElapsedTimer>
+#include <QStandardPaths>
+
+#include <wobjectimpl.h>
+
+#include <IscoreIntegrationTests.hpp>
+
+namespace
+{
+constexpr int effects = 50;
+
+// Distinct programs, so that each one has its own cache entry
+QByteArray program(int i)
+{
+  return "process = _ <: par(j, 16, *(j + " + QByteArray::number(i)
+         + ") : +~*(0.5)) :> _;";
+}
+}
+
+class FaustLoadBenchmark : public TestBase
+{
+  W_OBJECT(FaustLoadBenchmark)
+
+public:
+  FaustLoadBenchmark(int& argc, char** argv) : TestBase(argc, argv)
+  {
+  }
+
+private:
+  // Requests the factories of 50 Faust effects, as when loading a document.
+  // Measures the time spent on the GUI thread to request them, and the time
+  // until all of them are received.
+  void load(qint64& blocked, qint64& total)
+  {
+    Media::Faust::FactoryCompiler compiler;
+    QObject context;
+    int received = 0;
+    int valid = 0;
+
+    QElapsedTimer timer;
+    timer.start();
+    for (int i = 0; i < effects; i++)
+    {
+      compiler.compile(&context, program(i), [&](llvm_dsp_factory* fac) {
+        received++;
+        if (fac)
+        {
+          valid++;
+          deleteCDSPFactory(fac);
+        }
+      });
+    }
+    blocked = timer.elapsed();
+
+    QTRY_COMPARE_WITH_TIMEOUT(received, effects, 600000);
+    total = timer.elapsed();
+    QCOMPARE(valid, effects);
+  }
+
+  void initTestCase()
+  {
+    // Keeps the cache of the user untouched
+    QStandardPaths::setTestModeEnabled(true);
+    QDir{QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+         + "/faust"}
+        .removeRecursively();
+  }
+  W_SLOT(initTestCase)
+
+  void cleanupTestCase()
+  {
+    QDir{QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+         + "/faust"}
+        .removeRecursively();
+  }
+  W_SLOT(cleanupTestCase)
+
+  // Nothing is cached: every program is compiled. Before the cache, all of
+  // this time was spent on the GUI thread while opening the document.
+  void coldLoad()
+  {
+    qint64 blocked{}, total{};
+    load(blocked, total);
+    if (QTest::currentTestFailed())
+      return;
+    qDebug() << effects << "effects, cold:" << blocked
+             << "ms on the GUI thread," << total << "ms until compiled";
+  }
+  W_SLOT(coldLoad)
+
+  // Reopening the document: every factory comes from the cache.
+  void cachedLoad()
+  {
+    qint64 blocked{}, total{};
+    load(blocked, total);
+    if (QTest::currentTestFailed())
+      return;
+    qDebug() << effects << "effects, cached:" << blocked
+             << "ms on the GUI thread," << total << "ms until loaded";
+  }
+  W_SLOT(cachedLoad)
+};
+
+W_OBJECT_IMPL(FaustLoadBenchmark)
+SCORE_INTEGRATION_TEST(FaustLoadBenchmark)
@@ -0,0 +1,114 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <score/tools/IdentifierGeneration.hpp>
+
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include <wobjectimpl.h>
+
+#include <IscoreIntegrationTests.hpp>
+
+#include <unordered_set>
+
+namespace
+{
+struct Element
+{
+  Id<Element> m_id;
+  const Id<Element>& id() const
+  {
+    return m_id;
+  }
+};
+
+std::vector<Element> existingElements(int n)
+{
+  std::vector<Element> elts;
+  elts.reserve(n);
+  for (int i = 0; i < n; i++)
+    elts.push_back(Element{Id<Element>{2 * i + 1}});
+  return elts;
+}
+}
+
+class IdentifierGenerationBenchmark : public TestBase
+{
+  W_OBJECT(IdentifierGenerationBenchmark)
+
+public:
+  IdentifierGenerationBenchmark(int& argc, char** argv)
+      : TestBase(argc, argv)
+  {
+  }
+
+private:
+  void reserve_data()
+  {
+    QTest::addColumn<int>("existing");
+    QTest::addColumn<int>("reserved");
+    QTest::newRow("1000 in 1000") << 1000 << 1000;
+    QTest::newRow("5000 in 5000") << 5000 << 5000;
+    QTest::newRow("20000 in 20000") << 20000 << 20000;
+  }
+  W_SLOT(reserve_data)
+
+  // What a paste of `reserved` elements in a scenario of `existing` elements
+  // pays for its identifiers, compared to one getStrongId per element.
+  void reserve()
+  {
+    QFETCH(int, existing);
+    QFETCH(int, reserved);
+    const auto elts = existingElements(existing);
+
+    QElapsedTimer timer;
+    timer.start();
+    const auto ids = getStrongIdRange<Element>(reserved, elts);
+    const auto bulk = timer.nsecsElapsed();
+
+    QCOMPARE(int(ids.size()), reserved);
+    std::unordered_set<int32_t> seen;
+    for (const auto& e : elts)
+      seen.insert(e.id().val());
+    for (const auto& id : ids)
+      QVERIFY(seen.insert(id.val()).second);
+
+    // The previous implementation
+    timer.restart();
+    std::vector<Id<Element>> old;
+    old.reserve(existing + reserved);
+    for (const auto& e : elts)
+      old.push_back(e.id());
+    for (int i = 0; i < reserved; i++)
+      old.push_back(getStrongId(old));
+    const auto one_by_one = timer.nsecsElapsed();
+
+    qDebug() << existing << "existing," << reserved << "reserved:"
+             << bulk / 1000 << "us in bulk," << one_by_one / 1000
+             << "us one by one";
+
+    QBENCHMARK
+    {
+      getStrongIdRange<Element>(reserved, elts);
+    }
+  }
+  W_SLOT(reserve)
+
+  void reserveRandom()
+  {
+    std::vector<int32_t> existing;
+    for (int i = 0; i < 50000; i++)
+      existing.push_back(score::random_id_generator::getRandomId());
+
+    const auto ids = score::random_id_generator::getNextIds(existing, 50000);
+    QCOMPARE(int(ids.size()), 50000);
+
+    std::unordered_set<int32_t> seen(existing.begin(), existing.end());
+    for (auto id : ids)
+      QVERIFY(seen.insert(id).second);
+  }
+  W_SLOT(reserveRandom)
+};
+
+W_OBJECT_IMPL(IdentifierGenerationBenchmark)
+SCORE_INTEGRATION_TEST(IdentifierGenerationBenchmark)
@@ -27,14 +27,23 @@ score::ApplicationComponentsData&TestBase::componentsData()
   return m_presenter->components();
 }
 
-TestBase::TestBase(int& argc, char** argv)
+TestBase::TestBase(int& argc, char** argv, bool gui)
 {
   qApp->setAttribute(Qt::AA_Use96Dpi, true);
   QTEST_DISABLE_KEYPAD_NAVIGATION;
   QTEST_ADD_GPU_BLACKLIST_SUPPORT;
 
   m_applicationSettings.gui = false;
-  m_app = new QCoreApplication{argc, argv};
+  if (gui)
+  {
+    if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+      qputenv("QT_QPA_PLATFORM", "offscreen");
+    m_app = new QApplication{argc, argv};
+  }
+  else
+  {
+    m_app = new QCoreApplication{argc, argv};
+  }
   m_instance = this;
   this->setParent(m_app);
   // Settings
@@ -33,7 +33,10 @@ protected:
   score::ApplicationSettings m_applicationSettings;
   score::ApplicationComponentsData& componentsData();
 public:
-  TestBase(int& argc, char** argv);
+  //! With gui, the application is a QApplication, on the offscreen
+  //! platform unless another one is requested, so that graphics items
+  //! can be created.
+  TestBase(int& argc, char** argv, bool gui = false);
 
   const score::GUIApplicationContext& context() const override;
   const score::ApplicationComponents& components() const override;
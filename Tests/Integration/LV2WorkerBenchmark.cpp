@@ -0,0 +1,201 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <Media/Effect/LV2/LV2Context.hpp>
+#include <Media/Effect/LV2/LV2Worker.hpp>
+
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include <wobjectimpl.h>
+
+#include <IscoreIntegrationTests.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+namespace
+{
+using namespace std::chrono_literals;
+
+// A plug-in whose work takes some time, e.g. loading a sample, and which
+// answers each request with its content.
+struct FakePlugin
+{
+  std::chrono::microseconds workTime{};
+  std::atomic_int working{};
+  std::atomic_bool concurrentWork{};
+  std::vector<uint32_t> responses;
+};
+
+LV2_Worker_Status work(
+    LV2_Handle h, LV2_Worker_Respond_Function respond,
+    LV2_Worker_Respond_Handle handle, uint32_t size, const void* data)
+{
+  auto& p = *static_cast<FakePlugin*>(h);
+  if (p.working++ > 0)
+    p.concurrentWork = true;
+  std::this_thread::sleep_for(p.workTime);
+  p.working--;
+  return respond(handle, size, data);
+}
+
+LV2_Worker_Status
+work_response(LV2_Handle h, uint32_t size, const void* body)
+{
+  auto& p = *static_cast<FakePlugin*>(h);
+  uint32_t v{};
+  if (size == sizeof(v))
+  {
+    std::memcpy(&v, body, sizeof(v));
+    p.responses.push_back(v);
+  }
+  return LV2_WORKER_SUCCESS;
+}
+
+const LV2_Worker_Interface worker_interface{work, work_response, nullptr};
+
+struct FakeEffect
+{
+  explicit FakeEffect(std::chrono::microseconds t)
+  {
+    plugin.workTime = t;
+    instance.lv2_handle = &plugin;
+    effect.instance = &instance;
+    effect.worker = &worker_interface;
+    effect.worker_response.reserve(effect.worker_responses.capacity());
+    plugin.responses.reserve(100000);
+  }
+
+  // What the schedule feature does in the audio thread
+  bool schedule(Media::LV2::WorkerPool& pool, uint32_t value)
+  {
+    if (!effect.worker_requests.write(sizeof(value), &value))
+      return false;
+    pool.notify();
+    return true;
+  }
+
+  FakePlugin plugin;
+  LilvInstance instance{};
+  Media::LV2::EffectContext effect;
+};
+}
+
+class LV2WorkerBenchmark : public TestBase
+{
+  W_OBJECT(LV2WorkerBenchmark)
+
+public:
+  LV2WorkerBenchmark(int& argc, char** argv) : TestBase(argc, argv)
+  {
+  }
+
+private:
+  // Four plug-ins schedule work on each of 1000 audio cycles. Measures the
+  // time spent in the audio thread, which used to include the work itself,
+  // and checks that every response comes back, in order, without
+  // concurrent work() calls for an instance.
+  void audioThread()
+  {
+    constexpr int effects = 4;
+    constexpr int cycles = 1000;
+    constexpr auto work_time = 100us;
+
+    // The pool is destroyed first, so that it never outlives the effects
+    std::vector<std::unique_ptr<FakeEffect>> fx;
+    Media::LV2::WorkerPool pool;
+    for (int i = 0; i < effects; i++)
+    {
+      fx.push_back(std::make_unique<FakeEffect>(work_time));
+      pool.add(fx.back()->effect);
+    }
+
+    qint64 max_ns{}, total_ns{};
+    QElapsedTimer timer;
+    for (int c = 0; c < cycles; c++)
+    {
+      timer.start();
+      for (auto& f : fx)
+      {
+        Media::LV2::deliverWorkerResponses(f->effect);
+        QVERIFY(f->schedule(pool, uint32_t(c)));
+      }
+      const auto ns = timer.nsecsElapsed();
+      max_ns = std::max(max_ns, ns);
+      total_ns += ns;
+
+      // 64 frames at 44.1 kHz
+      std::this_thread::sleep_for(1450us);
+    }
+
+    auto all_received = [&] {
+      for (auto& f : fx)
+      {
+        Media::LV2::deliverWorkerResponses(f->effect);
+        if (int(f->plugin.responses.size()) < cycles)
+          return false;
+      }
+      return true;
+    };
+    QTRY_VERIFY_WITH_TIMEOUT(all_received(), 10000);
+
+    for (auto& f : fx)
+    {
+      pool.remove(f->effect);
+      QVERIFY(!f->plugin.concurrentWork);
+      QCOMPARE(int(f->plugin.responses.size()), cycles);
+      for (int c = 0; c < cycles; c++)
+        QCOMPARE(f->plugin.responses[c], uint32_t(c));
+    }
+
+    qDebug() << effects << "effects: audio thread"
+             << total_ns / (1000. * cycles) << "us per cycle on average,"
+             << max_ns / 1000. << "us at most ; the work takes"
+             << effects * work_time.count() << "us per cycle";
+  }
+  W_SLOT(audioThread)
+
+  // A full request ring reports no space instead of blocking
+  void fullRing()
+  {
+    Media::LV2::WorkerRing ring{64};
+    const uint32_t v = 42;
+    int written = 0;
+    while (ring.write(sizeof(v), &v))
+      written++;
+    QCOMPARE(written, 8);
+
+    std::vector<char> buf;
+    buf.reserve(ring.capacity());
+    int read = 0;
+    while (ring.read(buf))
+    {
+      QCOMPARE(int(buf.size()), int(sizeof(v)));
+      read++;
+    }
+    QCOMPARE(read, written);
+  }
+  W_SLOT(fullRing)
+
+  void schedule()
+  {
+    Media::LV2::WorkerPool pool;
+    FakeEffect f{0us};
+    uint32_t c = 0;
+    QBENCHMARK
+    {
+      if (!f.schedule(pool, c++))
+      {
+        std::vector<char> buf;
+        while (f.effect.worker_requests.read(buf))
+          ;
+      }
+    }
+  }
+  W_SLOT(schedule)
+};
+
+W_OBJECT_IMPL(LV2WorkerBenchmark)
+SCORE_INTEGRATION_TEST(LV2WorkerBenchmark)
@@ -0,0 +1,142 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <Process/LayerView.hpp>
+
+#include <QApplication>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QGraphicsScene>
+#include <QImage>
+#include <QPainter>
+#include <QtTest/QTest>
+
+#include <wobjectimpl.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+constexpr qreal layer_width = 20000.;
+constexpr qreal layer_height = 200.;
+constexpr int view_width = 1600;
+
+// Paints as many lines as a long sound file has waveform segments
+class ExpensiveLayer final : public Process::LayerView
+{
+public:
+  explicit ExpensiveLayer(bool cached) : Process::LayerView{nullptr}
+  {
+    setCached(cached);
+    setWidth(layer_width);
+    setHeight(layer_height);
+  }
+
+private:
+  void paint_impl(QPainter* p) const override
+  {
+    p->setPen(Qt::darkGreen);
+    const QRectF clip = p->clipBoundingRect();
+    const int first = clip.isEmpty() ? 0 : std::max(0., clip.left()) * 4;
+    const int last = clip.isEmpty() ? int(layer_width * 4)
+                                    : std::min(layer_width, clip.right()) * 4;
+    for (int i = first; i < last; i++)
+    {
+      const qreal x = i / 4.;
+      const qreal h = layer_height / 2. * (1. + std::sin(i * 0.01));
+      p->drawLine(QLineF{x, layer_height - h, x, h});
+    }
+  }
+};
+
+// Renders the part of the scene seen by a view of view_width pixels
+void renderView(QGraphicsScene& scene, QImage& img, qreal x)
+{
+  img.fill(Qt::white);
+  QPainter p{&img};
+  scene.render(
+      &p, QRectF{0, 0, qreal(view_width), layer_height},
+      QRectF{x, 0, qreal(view_width), layer_height});
+}
+}
+
+class LayerCacheBenchmark : public QObject
+{
+  W_OBJECT(LayerCacheBenchmark)
+
+private:
+  void scroll_data()
+  {
+    QTest::addColumn<bool>("cached");
+    QTest::newRow("uncached") << false;
+    QTest::newRow("cached") << true;
+  }
+  W_SLOT(scroll_data)
+
+  // Frame time when scrolling a long layer, and when repainting it in place
+  // as the play cursor does.
+  void scroll()
+  {
+    QFETCH(bool, cached);
+    QGraphicsScene scene;
+    auto layer = new ExpensiveLayer{cached};
+    scene.addItem(layer);
+
+    QImage img{view_width, int(layer_height), QImage::Format_ARGB32};
+
+    constexpr int frames = 200;
+    QElapsedTimer timer;
+    timer.start();
+    for (int f = 0; f < frames; f++)
+      renderView(scene, img, (f % 100) * 20.);
+    const auto scroll_ns = timer.nsecsElapsed();
+
+    timer.restart();
+    for (int f = 0; f < frames; f++)
+      renderView(scene, img, 0.);
+    const auto repaint_ns = timer.nsecsElapsed();
+
+    qDebug() << (cached ? "cached:" : "uncached:") << scroll_ns / (1e6 * frames)
+             << "ms per scrolled frame," << repaint_ns / (1e6 * frames)
+             << "ms per repainted frame";
+
+    qreal x = 0.;
+    QBENCHMARK
+    {
+      renderView(scene, img, x);
+      x = x >= 2000. ? 0. : x + 20.;
+    }
+  }
+  W_SLOT(scroll)
+
+  // The tiles give the same image as painting the layer directly
+  void sameRendering()
+  {
+    QGraphicsScene direct_scene, cached_scene;
+    direct_scene.addItem(new ExpensiveLayer{false});
+    cached_scene.addItem(new ExpensiveLayer{true});
+
+    QImage direct{view_width, int(layer_height), QImage::Format_ARGB32};
+    QImage cached{view_width, int(layer_height), QImage::Format_ARGB32};
+    for (qreal x : {0., 130., 1000., layer_width - view_width})
+    {
+      renderView(direct_scene, direct, x);
+      renderView(cached_scene, cached, x);
+      QCOMPARE(cached, direct);
+    }
+  }
+  W_SLOT(sameRendering)
+};
+
+W_OBJECT_IMPL(LayerCacheBenchmark)
+
+int main(int argc, char** argv)
+{
+  if (!qEnvironmentVariableIsSet("QT_QPA_PLATFORM"))
+    qputenv("QT_QPA_PLATFORM", "offscreen");
+
+  QApplication app{argc, argv};
+  LayerCacheBenchmark tc;
+  QTEST_SET_MAIN_SOURCE_PATH
+  return QTest::qExec(&tc, argc, argv);
+}
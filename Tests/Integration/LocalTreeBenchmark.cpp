@@ -0,0 +1,221 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <Explorer/Settings/ExplorerModel.hpp>
+#include <Scenario/Commands/CommandAPI.hpp>
+#include <Scenario/Commands/Scenario/Creations/CreationMetaCommand.hpp>
+#include <Scenario/Document/Interval/IntervalModel.hpp>
+#include <Scenario/Document/ScenarioDocument/ScenarioDocumentModel.hpp>
+#include <Scenario/Process/ScenarioModel.hpp>
+
+#include <score/document/DocumentInterface.hpp>
+#include <score/model/ModelMetadata.hpp>
+#include <score/plugins/documentdelegate/DocumentDelegateFactory.hpp>
+#include <score/tools/IdentifierGeneration.hpp>
+
+#include <core/document/Document.hpp>
+#include <core/presenter/DocumentManager.hpp>
+
+#include <ossia/network/base/node.hpp>
+
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QFile>
+
+#include <LocalTree/LocalTreeDocumentPlugin.hpp>
+#include <LocalTree/Scenario/IntervalComponent.hpp>
+#include <wobjectimpl.h>
+
+#include <IscoreIntegrationTests.hpp>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+
+namespace
+{
+struct TreeSize
+{
+  int nodes{};
+  int parameters{};
+};
+
+void count(const ossia::net::node_base& node, TreeSize& size)
+{
+  size.nodes++;
+  if (node.get_parameter())
+    size.parameters++;
+  for (const auto& child : node.children())
+    count(*child, size);
+}
+
+TreeSize count(const ossia::net::node_base& node)
+{
+  TreeSize size;
+  count(node, size);
+  return size;
+}
+
+//! Resident memory of the process, in kilobytes
+qint64 residentMemory()
+{
+#if defined(__linux__)
+  QFile statm{"/proc/self/statm"};
+  if (statm.open(QIODevice::ReadOnly))
+  {
+    const auto fields = statm.readAll().split(' ');
+    if (fields.size() > 1)
+      return fields[1].toLongLong() * sysconf(_SC_PAGESIZE) / 1024;
+  }
+#endif
+  return 0;
+}
+}
+
+class LocalTreeBenchmark : public TestBase
+{
+  W_OBJECT(LocalTreeBenchmark)
+
+public:
+  LocalTreeBenchmark(int& argc, char** argv) : TestBase(argc, argv)
+  {
+  }
+
+private:
+  score::Document* m_doc{};
+  Scenario::ProcessModel* m_scenario{};
+  bool m_localTree{};
+  bool m_lazyLocalTree{};
+
+  static constexpr int boxes = 5000;
+
+  // A score of 5000 boxes, i.e. 35000 intervals, events, time syncs and
+  // states, with a process in one interval out of ten.
+  void initTestCase()
+  {
+    auto& ctx = context();
+    auto& set = ctx.settings<Explorer::Settings::Model>();
+    m_localTree = set.getLocalTree();
+    m_lazyLocalTree = set.getLazyLocalTree();
+
+    ctx.docManager.newDocument(
+        ctx, Id<score::DocumentModel>{score::random_id_generator::getRandomId()},
+        *ctx.interfaces<score::DocumentDelegateList>().begin());
+    m_doc = ctx.docManager.currentDocument();
+    QVERIFY(m_doc);
+
+    auto& docctx = m_doc->context();
+    auto& model
+        = score::IDocument::modelDelegate<Scenario::ScenarioDocumentModel>(
+            *m_doc);
+    for (auto& proc : model.baseInterval().processes)
+      if ((m_scenario = dynamic_cast<Scenario::ProcessModel*>(&proc)))
+        break;
+    QVERIFY(m_scenario);
+
+    using namespace Scenario::Command;
+    Macro m{new CreationMetaCommand, docctx};
+    for (int i = 0; i < boxes; i++)
+      m.createBox(
+          *m_scenario, TimeVal::fromMsecs(100. * i),
+          TimeVal::fromMsecs(100. * i + 50.), 0.1 + 0.8 * i / boxes);
+
+    const auto key = Metadata<ConcreteKey_k, Scenario::ProcessModel>::get();
+    int i = 0;
+    for (const Scenario::IntervalModel& itv : m_scenario->intervals)
+      if (i++ % 10 == 0)
+        m.createProcess(itv, key, {});
+    m.commit();
+  }
+  W_SLOT(initTestCase)
+
+  void cleanupTestCase()
+  {
+    auto& set = context().settings<Explorer::Settings::Model>();
+    set.setLazyLocalTree(m_lazyLocalTree);
+    set.setLocalTree(m_localTree);
+  }
+  W_SLOT(cleanupTestCase)
+
+  void createTree_data()
+  {
+    QTest::addColumn<bool>("lazy");
+    QTest::newRow("eager") << false;
+    QTest::newRow("lazy") << true;
+  }
+  W_SLOT(createTree_data)
+
+  // Time and memory needed to expose the whole score in the local tree
+  void createTree()
+  {
+    QFETCH(bool, lazy);
+    auto& set = context().settings<Explorer::Settings::Model>();
+    set.setLocalTree(true);
+    set.setLazyLocalTree(lazy);
+
+    const qint64 mem = residentMemory();
+    QElapsedTimer timer;
+    timer.start();
+    auto plug = std::make_unique<LocalTree::DocumentPlugin>(
+        m_doc->context(), Id<score::DocumentPlugin>{999}, nullptr);
+    plug->init();
+    const auto ms = timer.elapsed();
+    const auto size = count(plug->device().get_root_node());
+    qDebug() << (lazy ? "lazy:" : "eager:") << ms << "ms," << size.nodes
+             << "nodes," << size.parameters << "parameters,"
+             << residentMemory() - mem << "kB";
+
+    QBENCHMARK
+    {
+      LocalTree::DocumentPlugin p{m_doc->context(),
+                                  Id<score::DocumentPlugin>{998}, nullptr};
+      p.init();
+    }
+  }
+  W_SLOT(createTree)
+
+  // In lazy mode, flagging an interval creates its parameters and the ones
+  // of its processes.
+  void materializeInterval()
+  {
+    auto& set = context().settings<Explorer::Settings::Model>();
+    set.setLocalTree(true);
+    set.setLazyLocalTree(true);
+
+    LocalTree::DocumentPlugin plug{m_doc->context(),
+                                   Id<score::DocumentPlugin>{999}, nullptr};
+    plug.init();
+
+    Scenario::IntervalModel* itv{};
+    for (Scenario::IntervalModel& i : m_scenario->intervals)
+      if (!i.processes.empty())
+      {
+        itv = &i;
+        break;
+      }
+    QVERIFY(itv);
+
+    LocalTree::Interval* comp{};
+    for (auto& c : itv->components())
+    {
+      auto lt = dynamic_cast<LocalTree::Interval*>(&c);
+      if (lt && &lt->system() == &plug)
+        comp = lt;
+    }
+    QVERIFY(comp);
+
+    auto processes = comp->node().find_child(std::string("processes"));
+    QVERIFY(processes);
+    QCOMPARE(count(comp->node()).parameters, 0);
+
+    auto meta = itv->metadata().getExtendedMetadata();
+    meta["RemoteControl"] = true;
+    itv->metadata().setExtendedMetadata(meta);
+
+    QVERIFY(count(comp->node()).parameters > 0);
+    QVERIFY(count(*processes).parameters > 0);
+  }
+  W_SLOT(materializeInterval)
+};
+
+W_OBJECT_IMPL(LocalTreeBenchmark)
+SCORE_INTEGRATION_TEST(LocalTreeBenchmark)
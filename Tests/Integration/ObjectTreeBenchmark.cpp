@@ -0,0 +1,124 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <Scenario/Commands/CommandAPI.hpp>
+#include <Scenario/Commands/Interval/CreateProcessInNewSlot.hpp>
+#include <Scenario/Commands/Scenario/Creations/CreateStateMacro.hpp>
+#include <Scenario/Commands/Scenario/Creations/CreationMetaCommand.hpp>
+#include <Scenario/Document/Event/EventModel.hpp>
+#include <Scenario/Document/Interval/IntervalModel.hpp>
+#include <Scenario/Document/ScenarioDocument/ScenarioDocumentModel.hpp>
+#include <Scenario/Document/TimeSync/TimeSyncModel.hpp>
+#include <Scenario/Inspector/ObjectTree/ObjectItemModel.hpp>
+#include <Scenario/Process/Algorithms/Accessors.hpp>
+#include <Scenario/Process/ScenarioModel.hpp>
+
+#include <score/document/DocumentInterface.hpp>
+#include <score/plugins/documentdelegate/DocumentDelegateFactory.hpp>
+#include <score/tools/IdentifierGeneration.hpp>
+
+#include <core/command/CommandStack.hpp>
+#include <core/document/Document.hpp>
+#include <core/presenter/DocumentManager.hpp>
+
+#include <QtGlobal>
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+#include <QAbstractItemModelTester>
+#endif
+
+#include <wobjectimpl.h>
+
+#include <IscoreIntegrationTests.hpp>
+
+class ObjectTreeBenchmark : public TestBase
+{
+  W_OBJECT(ObjectTreeBenchmark)
+
+public:
+  ObjectTreeBenchmark(int& argc, char** argv) : TestBase(argc, argv)
+  {
+  }
+
+private:
+  // Adds and removes processes and states under a large selection: only the
+  // rows which change are notified, and the item model contract holds.
+  void repeatedEditsUnderLargeSelection()
+  {
+    auto& ctx = context();
+    ctx.docManager.newDocument(
+        ctx, Id<score::DocumentModel>{score::random_id_generator::getRandomId()},
+        *ctx.interfaces<score::DocumentDelegateList>().begin());
+    auto doc = ctx.docManager.currentDocument();
+    QVERIFY(doc);
+
+    auto& docctx = doc->context();
+    auto& model
+        = score::IDocument::modelDelegate<Scenario::ScenarioDocumentModel>(
+            *doc);
+    Scenario::ProcessModel* scenar{};
+    for (auto& proc : model.baseInterval().processes)
+      if ((scenar = dynamic_cast<Scenario::ProcessModel*>(&proc)))
+        break;
+    QVERIFY(scenar);
+
+    constexpr int boxes = 500;
+    constexpr int edits = 20;
+    {
+      using namespace Scenario::Command;
+      Macro m{new CreationMetaCommand, docctx};
+      for (int i = 0; i < boxes; i++)
+        m.createBox(
+            *scenar, TimeVal::fromMsecs(100. * i),
+            TimeVal::fromMsecs(100. * i + 50.), 0.1 + 0.8 * i / boxes);
+      m.commit();
+    }
+
+    QList<const IdentifiedObjectAbstract*> sel;
+    std::vector<const Scenario::IntervalModel*> intervals;
+    for (const Scenario::IntervalModel& itv : scenar->intervals)
+    {
+      sel.push_back(&itv);
+      intervals.push_back(&itv);
+    }
+    for (const Scenario::TimeSyncModel& ts : scenar->timeSyncs)
+      sel.push_back(&ts);
+
+    Scenario::ObjectItemModel tree{docctx, this};
+#if QT_VERSION >= QT_VERSION_CHECK(5, 11, 0)
+    QAbstractItemModelTester tester{
+        &tree, QAbstractItemModelTester::FailureReportingMode::QtTest};
+#endif
+    tree.setSelected(sel);
+    const int roots = tree.rowCount({});
+    QCOMPARE(roots, sel.size());
+
+    const auto key = Metadata<ConcreteKey_k, Scenario::ProcessModel>::get();
+    auto& stack = doc->commandStack();
+    QBENCHMARK
+    {
+      for (int i = 0; i < edits; i++)
+      {
+        using namespace Scenario::Command;
+        const auto& itv = *intervals[i];
+        {
+          Macro m{new AddProcessInNewSlot, docctx};
+          m.createProcess(itv, key, {});
+          m.commit();
+        }
+        {
+          Macro m{new CreateStateMacro, docctx};
+          m.createState(*scenar, Scenario::startEvent(itv, *scenar).id(), 0.9);
+          m.commit();
+        }
+      }
+
+      for (int i = 0; i < 2 * edits; i++)
+        stack.undo();
+    }
+
+    QCOMPARE(tree.rowCount({}), roots);
+  }
+  W_SLOT(repeatedEditsUnderLargeSelection)
+};
+
+W_OBJECT_IMPL(ObjectTreeBenchmark)
+SCORE_INTEGRATION_TEST(ObjectTreeBenchmark)
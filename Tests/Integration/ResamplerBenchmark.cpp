@@ -0,0 +1,140 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <Media/Sound/Resampler.hpp>
+
+#include <ossia/detail/math.hpp>
+
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include <wobjectimpl.h>
+
+#include <IscoreIntegrationTests.hpp>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+std::vector<float> sine(double rate, double freq, int64_t n)
+{
+  std::vector<float> v(n);
+  for (int64_t i = 0; i < n; i++)
+    v[i] = std::sin(2. * ossia::pi * freq * i / rate);
+  return v;
+}
+
+struct Resampled
+{
+  std::vector<float> in;
+  std::vector<float> out;
+  qint64 ns{};
+};
+
+// One second of a sine at in_rate, played at out_rate
+Resampled resample(double in_rate, double out_rate, double freq)
+{
+  Resampled r;
+  r.in = sine(in_rate, freq, int64_t(in_rate));
+
+  const double ratio = in_rate / out_rate;
+  Media::Sound::PolyphaseResampler resampler{ratio};
+  r.out.resize(int64_t(r.in.size() / ratio));
+
+  QElapsedTimer timer;
+  timer.start();
+  resampler.process(
+      r.in.data(), r.in.size(), 0., ratio, r.out.data(), r.out.size());
+  r.ns = timer.nsecsElapsed();
+  return r;
+}
+
+// Samples near the ends of the buffer only see part of the filter
+constexpr int edge = Media::Sound::PolyphaseResampler::taps;
+}
+
+class ResamplerBenchmark : public TestBase
+{
+  W_OBJECT(ResamplerBenchmark)
+
+public:
+  ResamplerBenchmark(int& argc, char** argv) : TestBase(argc, argv)
+  {
+  }
+
+private:
+  void passband_data()
+  {
+    QTest::addColumn<double>("in_rate");
+    QTest::addColumn<double>("out_rate");
+    QTest::addColumn<double>("freq");
+    QTest::newRow("48k to 44.1k, 1 kHz") << 48000. << 44100. << 1000.;
+    QTest::newRow("44.1k to 48k, 1 kHz") << 44100. << 48000. << 1000.;
+    QTest::newRow("44.1k to 48k, 10 kHz") << 44100. << 48000. << 10000.;
+    QTest::newRow("96k to 44.1k, 5 kHz") << 96000. << 44100. << 5000.;
+    QTest::newRow("44.1k to 44.1k, 15 kHz") << 44100. << 44100. << 15000.;
+  }
+  W_SLOT(passband_data)
+
+  // A tone below the Nyquist frequency of both rates is kept intact
+  void passband()
+  {
+    QFETCH(double, in_rate);
+    QFETCH(double, out_rate);
+    QFETCH(double, freq);
+    const auto r = resample(in_rate, out_rate, freq);
+
+    double max_error = 0., signal = 0., noise = 0.;
+    for (std::size_t k = edge; k < r.out.size() - edge; k++)
+    {
+      const double expected = std::sin(2. * ossia::pi * freq * k / out_rate);
+      const double error = r.out[k] - expected;
+      max_error = std::max(max_error, std::abs(error));
+      signal += expected * expected;
+      noise += error * error;
+    }
+    const double snr = 10. * std::log10(signal / noise);
+
+    qDebug() << in_rate << "->" << out_rate << freq << "Hz: maximum error"
+             << max_error << ", SNR" << snr << "dB,"
+             << double(r.ns) / r.out.size() << "ns per sample";
+    QVERIFY(snr > 80.);
+  }
+  W_SLOT(passband)
+
+  // A tone above the Nyquist frequency of the output is filtered out
+  void stopband()
+  {
+    const auto r = resample(96000., 44100., 30000.);
+
+    double power = 0.;
+    for (std::size_t k = edge; k < r.out.size() - edge; k++)
+      power += r.out[k] * r.out[k];
+    const double rms = std::sqrt(power / (r.out.size() - 2 * edge));
+    const double attenuation = 20. * std::log10(rms / std::sqrt(0.5));
+
+    qDebug() << "30 kHz from 96k to 44.1k:" << attenuation << "dB";
+    QVERIFY(attenuation < -60.);
+  }
+  W_SLOT(stopband)
+
+  // Cost of a tick of 512 samples
+  void cpu()
+  {
+    const auto in = sine(48000., 1000., 48000);
+    Media::Sound::PolyphaseResampler resampler{48000. / 44100.};
+    std::vector<float> out(512);
+    double pos = 1000.;
+    QBENCHMARK
+    {
+      resampler.process(
+          in.data(), in.size(), pos, resampler.ratio(), out.data(),
+          out.size());
+      pos = pos > 40000. ? 1000. : pos + 512 * resampler.ratio();
+    }
+  }
+  W_SLOT(cpu)
+};
+
+W_OBJECT_IMPL(ResamplerBenchmark)
+SCORE_INTEGRATION_TEST(ResamplerBenchmark)
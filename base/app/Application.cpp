@@ -11,6 +11,7 @@
 #include <score/plugins/documentdelegate/DocumentDelegateFactory.hpp>
 #include <score/selection/Selection.hpp>
 #include <score/tools/IdentifierGeneration.hpp>
+#include <score/tools/StartupTrace.hpp>
 #include <score/tools/std/Optional.hpp>
 #include <score/widgets/Pixmap.hpp>
 
@@ -77,14 +78,20 @@ static void setQApplicationSettings(QApplication& m_app)
   qInitResources_score();
 #endif
 
-  QFontDatabase::addApplicationFont(":/APCCourierBold.otf"); // APCCourier-Bold
-  QFontDatabase::addApplicationFont(":/Ubuntu-R.ttf");       // Ubuntu Regular
-  QFontDatabase::addApplicationFont(":/Ubuntu-B.ttf");       // Ubuntu Bold
-  QFontDatabase::addApplicationFont(":/Ubuntu-L.ttf");       // Ubuntu Light
-  QFontDatabase::addApplicationFont(
-      ":/Catamaran-Regular.ttf"); // Catamaran Regular
-  QFontDatabase::addApplicationFont(":/Montserrat-Regular.ttf"); // Montserrat
+  {
+    StartupTrace::Scope _{"resources", "Fonts"};
+    QFontDatabase::addApplicationFont(
+        ":/APCCourierBold.otf"); // APCCourier-Bold
+    QFontDatabase::addApplicationFont(":/Ubuntu-R.ttf"); // Ubuntu Regular
+    QFontDatabase::addApplicationFont(":/Ubuntu-B.ttf"); // Ubuntu Bold
+    QFontDatabase::addApplicationFont(":/Ubuntu-L.ttf"); // Ubuntu Light
+    QFontDatabase::addApplicationFont(
+        ":/Catamaran-Regular.ttf"); // Catamaran Regular
+    QFontDatabase::addApplicationFont(
+        ":/Montserrat-Regular.ttf"); // Montserrat
+  }
 
+  StartupTrace::Scope _{"resources", "Style sheet"};
   QFile stylesheet_file{
       ":/qsimpledarkstyle.qss"}; //":/qdarkstyle/qdarkstyle.qss"};
   stylesheet_file.open(QFile::ReadOnly);
@@ -192,6 +199,15 @@ static QPixmap writeVersionName()
 }
 
 void Application::init()
+{
+  {
+    score::StartupTrace::Scope _{"startup", "Application::init"};
+    initImpl();
+  }
+  score::StartupTrace::dump();
+}
+
+void Application::initImpl()
 {
 #if defined(SCORE_STATIC_PLUGINS)
   score_init_static_plugins();
@@ -236,6 +252,7 @@ void Application::init()
   if (m_applicationSettings.gui)
   {
     score::setQApplicationSettings(*qApp);
+    score::StartupTrace::Scope _{"gui", "Main window"};
     m_settings.setupView();
     m_projectSettings.setupView();
     m_view = new score::View{this};
@@ -250,6 +267,7 @@ void Application::init()
   // View
   if (m_applicationSettings.gui)
   {
+    score::StartupTrace::Scope _{"gui", "Show main window"};
 #if !defined(__EMSCRIPTEN__)
     m_view->show();
 #else
@@ -266,7 +284,10 @@ void Application::init()
 #endif
   }
 
-  initDocuments();
+  {
+    score::StartupTrace::Scope _{"documents", "Initial documents"};
+    initDocuments();
+  }
 
   if (m_applicationSettings.gui)
   {
@@ -58,6 +58,7 @@ public:
   void init(); // m_applicationSettings has to be set.
 
 private:
+  void initImpl();
   void initDocuments();
   void loadPluginData();
 
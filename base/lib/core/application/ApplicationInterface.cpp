@@ -8,6 +8,7 @@
 #include <score/plugins/documentdelegate/DocumentDelegateFactory.hpp>
 #include <score/plugins/documentdelegate/plugin/DocumentPlugin.hpp>
 #include <score/plugins/settingsdelegate/SettingsDelegateFactory.hpp>
+#include <score/tools/StartupTrace.hpp>
 
 #include <core/application/ApplicationRegistrar.hpp>
 #include <core/messages/MessagesPanel.hpp>
@@ -19,8 +20,19 @@
 #include <core/view/Window.hpp>
 
 #include <QModelIndex>
+
+#include <typeinfo>
 namespace score
 {
+namespace
+{
+template <typename T>
+auto traceName(const T& obj)
+{
+  return [&obj] { return StartupTrace::typeName(typeid(obj)); };
+}
+}
+
 ApplicationInterface* ApplicationInterface::m_instance;
 ApplicationInterface::~ApplicationInterface() = default;
 
@@ -83,18 +95,22 @@ void GUIApplicationInterface::loadPluginData(
   QSettings s;
   for (auto& elt : ctx.interfaces<score::SettingsDelegateFactoryList>())
   {
+    StartupTrace::Scope _{"settings", traceName(elt)};
     settings.setupSettingsPlugin(s, ctx, elt);
   }
   if (presenter.view())
   {
+    StartupTrace::Scope _{"gui", "Setup GUI"};
     presenter.setupGUI();
   }
   for (score::ApplicationPlugin* app_plug : ctx.applicationPlugins())
   {
+    StartupTrace::Scope _{"initialize", traceName(*app_plug)};
     app_plug->initialize();
   }
   for (score::GUIApplicationPlugin* app_plug : ctx.guiApplicationPlugins())
   {
+    StartupTrace::Scope _{"initialize", traceName(*app_plug)};
     app_plug->initialize();
   }
 
@@ -102,11 +118,13 @@ void GUIApplicationInterface::loadPluginData(
   {
     for (auto& panel_fac : ctx.interfaces<score::PanelDelegateFactoryList>())
     {
+      StartupTrace::Scope _{"panels", traceName(panel_fac)};
       registrar.registerPanel(panel_fac);
     }
 
     for (auto& panel : registrar.components().panels)
     {
+      StartupTrace::Scope _{"panels", traceName(*panel)};
       presenter.view()->setupPanel(panel.get());
     }
   }
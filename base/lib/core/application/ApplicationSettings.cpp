@@ -37,6 +37,13 @@ void ApplicationSettings::parse(QStringList cargs, int& argc, char** argv)
       QCoreApplication::translate("main", "Auto-play the loaded scenario"));
   parser.addOption(autoplayOpt);
 
+  QCommandLineOption undoBudgetOpt(
+      "undo-budget",
+      QCoreApplication::translate(
+          "main", "Memory of the undo history of a document, 0 for no limit"),
+      QCoreApplication::translate("main", "MiB"));
+  parser.addOption(undoBudgetOpt);
+
   if (cargs.contains("--help") || cargs.contains("--version"))
   {
     QCoreApplication app(argc, argv);
@@ -56,6 +63,13 @@ void ApplicationSettings::parse(QStringList cargs, int& argc, char** argv)
   if (!gui)
     tryToRestore = false;
   autoplay = parser.isSet(autoplayOpt) && args.size() == 1;
+  if (parser.isSet(undoBudgetOpt))
+  {
+    bool ok{};
+    const int budget = parser.value(undoBudgetOpt).toInt(&ok);
+    if (ok && budget >= 0)
+      undoMemoryBudget = budget;
+  }
 
   if (!args.empty() && QFile::exists(args[0]))
   {
@@ -24,6 +24,10 @@ struct SCORE_LIB_BASE_EXPORT ApplicationSettings
   //! If true, will start playing after loading the scenarios
   bool autoplay = false;
 
+  //! Memory in MiB kept by the undo history of a document before its
+  //! oldest commands are moved to disk. 0 means no limit.
+  int undoMemoryBudget = 512;
+
   //! The version of the base score framework's JSON save file.
   score::Version saveFormatVersion{2};
 
@@ -8,6 +8,9 @@
 
 #include <core/command/CommandStack.hpp>
 
+#include <algorithm>
+#include <vector>
+
 namespace score
 {
 CommandStackBackup::CommandStackBackup(const CommandStack& stack)
@@ -109,17 +112,45 @@ void CommandBackupFile::on_indexChanged()
 
 void CommandBackupFile::commit()
 {
-  // OPTIMIZEME: right now all the data is flushed each time.
-  // It should be better to only incrementally modify the file.
-  // See :
-  // http://www.boost.org/doc/libs/1_59_0/doc/html/interprocess/sharedmemorybetweenprocesses.html#interprocess.sharedmemorybetweenprocesses.mapped_file
+  // OPTIMIZEME: right now all the data is flushed each time, except for
+  // the commands that the stack moved to disk at the bottom of the undo
+  // stack: they do not change, and are not read back from the disk on each
+  // new command. They stay in place and the file is rewritten after them.
+  const auto& undo = m_stack.m_undoable;
+  const auto& redo = m_stack.m_redoable;
+  const int spilled = std::min(m_stack.m_spillIndex, undo.size());
+
+  std::size_t kept = 0;
+  while (kept < m_spilled.size() && int(kept) < spilled
+         && m_spilled[kept].first == undo[int(kept)])
+    kept++;
+  m_spilled.resize(kept);
+
+  DataStream::Serializer ser(&m_file);
 
-  // Another possibility would be to save the commands to a db ?
-  m_file.resize(0);
+  // Same layout as the serialization of the command stack
   m_file.reset();
+  ser.stream() << (int32_t)undo.size();
 
-  DataStream::Serializer ser(&m_file);
-  ser.readFrom(m_stack);
+  const qint64 start = kept > 0 ? m_spilled.back().second : m_file.pos();
+  m_file.resize(start);
+  m_file.seek(start);
+
+  for (int i = int(kept); i < undo.size(); i++)
+  {
+    ser.readFrom(CommandData{*undo[i]});
+    if (i < spilled)
+      m_spilled.emplace_back(undo[i], m_file.pos());
+  }
+  SCORE_DEBUG_INSERT_DELIMITER2(ser);
+
+  std::vector<CommandData> redoStack;
+  redoStack.reserve(redo.size());
+  for (const auto& cmd : redo)
+    redoStack.emplace_back(*cmd);
+  ser.readFrom(redoStack);
+
+  ser.insertDelimiter();
 
   m_file.flush();
 }
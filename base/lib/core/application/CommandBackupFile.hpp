@@ -9,6 +9,9 @@
 #include <QString>
 #include <QTemporaryFile>
 
+#include <utility>
+#include <vector>
+
 namespace score
 {
 class CommandStack;
@@ -50,6 +53,10 @@ private:
   const score::CommandStack& m_stack;
   CommandStackBackup m_backup;
 
+  // The commands moved to disk at the bottom of the undo stack,
+  // with the position of their end in the file.
+  std::vector<std::pair<const score::Command*, qint64>> m_spilled;
+
   QTemporaryFile m_file;
 };
 }
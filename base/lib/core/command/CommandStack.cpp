@@ -1,23 +1,134 @@
 // This is an open source non-commercial project. Dear PVS-Studio, please check
 // it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <score/application/ApplicationContext.hpp>
 #include <score/command/Command.hpp>
+#include <score/command/CommandData.hpp>
 #include <score/command/Validity/ValidityChecker.hpp>
 #include <score/document/DocumentContext.hpp>
+#include <score/serialization/DataStreamVisitor.hpp>
 
+#include <core/application/ApplicationSettings.hpp>
 #include <core/command/CommandStack.hpp>
 #include <core/document/Document.hpp>
 
+#include <QTemporaryFile>
 #include <QVector>
 #include <QtAlgorithms>
 
 #include <wobjectimpl.h>
+
+#include <algorithm>
 W_OBJECT_IMPL(score::CommandStack)
 namespace score
 {
+namespace
+{
+/**
+ * @brief A command whose data was moved to a file
+ *
+ * The actual command is instantiated again from its serialized data each
+ * time it is undone or redone.
+ */
+class SpilledCommand final : public score::Command
+{
+public:
+  SpilledCommand(const score::Command& cmd, QFile& file)
+      : m_parentKey{cmd.parentKey()}
+      , m_key{cmd.key()}
+      , m_description{cmd.description()}
+      , m_file{file}
+  {
+    const auto data = cmd.serialize();
+    m_offset = m_file.size();
+    m_size = data.size();
+
+    m_file.seek(m_offset);
+    m_file.write(data);
+    m_file.flush();
+  }
+
+  void undo(const score::DocumentContext& ctx) const override
+  {
+    // Null if the plug-in of the command is not available anymore
+    std::unique_ptr<score::Command> cmd{load(ctx)};
+    if (cmd)
+      cmd->undo(ctx);
+  }
+
+  void redo(const score::DocumentContext& ctx) const override
+  {
+    // Null if the plug-in of the command is not available anymore
+    std::unique_ptr<score::Command> cmd{load(ctx)};
+    if (cmd)
+      cmd->redo(ctx);
+  }
+
+  const CommandGroupKey& parentKey() const noexcept override
+  {
+    return m_parentKey;
+  }
+  const CommandKey& key() const noexcept override
+  {
+    return m_key;
+  }
+  QString description() const override
+  {
+    return m_description;
+  }
+
+  std::size_t memoryUsage() const noexcept
+  {
+    return sizeof(*this) + m_description.size() * sizeof(QChar);
+  }
+
+private:
+  QByteArray data() const
+  {
+    m_file.seek(m_offset);
+    return m_file.read(m_size);
+  }
+
+  score::Command* load(const score::DocumentContext& ctx) const
+  {
+    CommandData d;
+    d.parentKey = m_parentKey;
+    d.commandKey = m_key;
+    d.data = data();
+    return ctx.app.instantiateUndoCommand(d);
+  }
+
+  // Gives the same data as the original command, e.g. for the backups
+  void serializeImpl(DataStreamInput& s) const override
+  {
+    const auto arr = data();
+    s.stream.writeRawData(arr.constData(), arr.size());
+  }
+
+  void deserializeImpl(DataStreamOutput&) override
+  {
+  }
+
+  CommandGroupKey m_parentKey;
+  CommandKey m_key;
+  QString m_description;
+
+  QFile& m_file;
+  qint64 m_offset{};
+  qint64 m_size{};
+};
+
+// Consecutive commands are merged when pushed within this delay
+constexpr int mergeDelay = 1000;
+}
+
 CommandStack::CommandStack(const score::Document& ctx, QObject* parent)
     : m_checker{score::AppComponents().interfaces<ValidityCheckerList>(), ctx}
     , m_ctx{ctx.context()}
 {
+  // The document context is not built yet at this point
+  const auto budget
+      = score::AppContext().applicationSettings.undoMemoryBudget;
+  m_memoryBudget = std::size_t(budget) * 1024 * 1024;
   this->setObjectName("CommandStack");
   this->setParent(parent);
 }
@@ -86,6 +197,95 @@ int CommandStack::currentIndex() const
   return m_undoable.size();
 }
 
+std::size_t CommandStack::memoryUsage(int index) const
+{
+  auto cmd = command(index);
+  return cmd ? accountFor(cmd) : 0;
+}
+
+std::size_t CommandStack::memoryUsage() const
+{
+  for (auto cmd : m_undoable)
+    accountFor(cmd);
+  for (auto cmd : m_redoable)
+    accountFor(cmd);
+  return m_memory;
+}
+
+void CommandStack::setMemoryBudget(std::size_t bytes)
+{
+  m_memoryBudget = bytes;
+  // The commands pushed without a budget were not measured
+  if (m_memoryBudget != 0)
+    memoryUsage();
+  spill();
+}
+
+std::size_t CommandStack::accountFor(const Command* cmd) const
+{
+  auto it = m_sizes.find(cmd);
+  if (it != m_sizes.end())
+    return it->second;
+
+  std::size_t sz{};
+  if (auto spilled = dynamic_cast<const SpilledCommand*>(cmd))
+    sz = spilled->memoryUsage();
+  else
+    sz = sizeof(Command) + cmd->serializedSize();
+
+  m_sizes.insert({cmd, sz});
+  m_memory += sz;
+  return sz;
+}
+
+void CommandStack::forget(const Command* cmd)
+{
+  auto it = m_sizes.find(cmd);
+  if (it != m_sizes.end())
+  {
+    m_memory -= it->second;
+    m_sizes.erase(it);
+  }
+}
+
+void CommandStack::settleTop()
+{
+  // Without a budget the sizes are only needed by memoryUsage()
+  if (m_memoryBudget != 0 && !m_undoable.empty())
+    accountFor(m_undoable.top());
+}
+
+void CommandStack::spill()
+{
+  if (m_memoryBudget == 0 || m_memory <= m_memoryBudget)
+    return;
+
+  if (!m_spillFile)
+  {
+    m_spillFile = std::make_unique<QTemporaryFile>();
+    if (!m_spillFile->open())
+    {
+      m_spillFile.reset();
+      return;
+    }
+  }
+
+  // The latest command is kept so that it can still be merged
+  m_spillIndex = std::min(m_spillIndex, m_undoable.size());
+  while (m_memory > m_memoryBudget && m_spillIndex < m_undoable.size() - 1)
+  {
+    auto& cmd = m_undoable[m_spillIndex++];
+    if (dynamic_cast<SpilledCommand*>(cmd))
+      continue;
+
+    auto spilled = new SpilledCommand{*cmd, *m_spillFile};
+    forget(cmd);
+    delete cmd;
+    cmd = spilled;
+    accountFor(cmd);
+  }
+}
+
 void CommandStack::markCurrentIndexAsSaved()
 {
   setSavedIndex(currentIndex());
@@ -120,10 +320,12 @@ void CommandStack::setIndex(int index)
 
 void CommandStack::undoQuiet()
 {
+  m_lastPush.invalidate();
   updateStack([&]() {
     auto cmd = m_undoable.pop();
     cmd->undo(m_ctx);
     m_redoable.push(cmd);
+    m_spillIndex = std::min(m_spillIndex, m_undoable.size());
 
     sig_undo();
   });
@@ -131,10 +333,12 @@ void CommandStack::undoQuiet()
 
 void CommandStack::redoQuiet()
 {
+  m_lastPush.invalidate();
   updateStack([&]() {
     auto cmd = m_redoable.pop();
     cmd->redo(m_ctx);
 
+    settleTop();
     m_undoable.push(cmd);
 
     sig_redo();
@@ -149,23 +353,7 @@ void CommandStack::redoAndPush(Command* cmd)
 
 void CommandStack::push(Command* cmd)
 {
-  localCommand(cmd);
-  updateStack([&]() {
-    // We lose the state we saved
-    if (currentIndex() < m_savedIndex)
-      setSavedIndex(-1);
-
-    // Push operation
-    m_undoable.push(cmd);
-
-    if (!m_redoable.empty())
-    {
-      qDeleteAll(m_redoable);
-      m_redoable.clear();
-    }
-
-    sig_push();
-  });
+  localCommand(pushImpl(cmd));
 }
 
 void CommandStack::redoAndPushQuiet(Command* cmd)
@@ -176,26 +364,106 @@ void CommandStack::redoAndPushQuiet(Command* cmd)
 
 void CommandStack::pushQuiet(Command* cmd)
 {
+  pushImpl(cmd);
+}
+
+Command* CommandStack::pushImpl(Command* cmd)
+{
+  Command* pushed = cmd;
   updateStack([&]() {
     // We lose the state we saved
     if (currentIndex() < m_savedIndex)
       setSavedIndex(-1);
 
-    // Push operation
-    m_undoable.push(cmd);
-
-    if (!m_redoable.empty())
+    if (tryMerge(*cmd))
+    {
+      delete cmd;
+      pushed = m_undoable.top();
+    }
+    else
     {
-      qDeleteAll(m_redoable);
-      m_redoable.clear();
+      // The previous command cannot be merged into anymore: its size is final
+      settleTop();
+
+      // Push operation
+      m_undoable.push(cmd);
+      clearRedoable();
     }
 
+    m_lastPush.start();
+    spill();
+
     sig_push();
   });
+  return pushed;
+}
+
+bool CommandStack::tryMerge(Command& cmd)
+{
+  // Only merge in the command which was pushed just before, and not in the
+  // one which corresponds to the saved state.
+  if (m_undoable.empty() || !m_redoable.empty() || !m_lastPush.isValid()
+      || m_lastPush.elapsed() > mergeDelay || currentIndex() == m_savedIndex)
+    return false;
+
+  auto prev = m_undoable.top();
+  if (prev->parentKey() != cmd.parentKey() || prev->key() != cmd.key())
+    return false;
+
+  if (!prev->mergeWith(cmd))
+    return false;
+
+  // Its size changed: it is measured again once it leaves the top
+  forget(prev);
+  return true;
+}
+
+void CommandStack::clearRedoable()
+{
+  if (!m_redoable.empty())
+  {
+    for (auto cmd : m_redoable)
+      forget(cmd);
+    qDeleteAll(m_redoable);
+    m_redoable.clear();
+  }
 }
 
 void CommandStack::setSavedIndex(int index)
 {
   m_savedIndex = index;
 }
+
+void CommandStack::restore(
+    std::vector<std::unique_ptr<Command>> undoable,
+    std::vector<std::unique_ptr<Command>> redoable)
+{
+  m_lastPush.invalidate();
+  updateStack([&]() {
+    setSavedIndex(-1);
+
+    qDeleteAll(m_undoable);
+    qDeleteAll(m_redoable);
+    m_undoable.clear();
+    m_redoable.clear();
+
+    m_sizes.clear();
+    m_memory = 0;
+    m_spillIndex = 0;
+    m_spillFile.reset();
+
+    for (auto& cmd : undoable)
+    {
+      m_undoable.push(cmd.release());
+      accountFor(m_undoable.top());
+    }
+    for (auto& cmd : redoable)
+    {
+      m_redoable.push(cmd.release());
+      accountFor(m_redoable.top());
+    }
+
+    spill();
+  });
+}
 }
@@ -1,13 +1,19 @@
 #pragma once
 #include <score/command/Command.hpp>
 #include <score/command/Validity/ValidityChecker.hpp>
+#include <score/tools/std/HashMap.hpp>
 
+#include <QElapsedTimer>
 #include <QObject>
 #include <QStack>
 #include <QString>
 
 #include <wobjectdefs.h>
 
+#include <memory>
+#include <vector>
+
+class QTemporaryFile;
 namespace score
 {
 class Document;
@@ -21,6 +27,12 @@ class Document;
  * This class should never be used directly to send commands.
  * Instead, the various command dispatchers, in score/command/Dispatchers
  * should be used.
+ *
+ * A command pushed shortly after a command with the same key is merged in
+ * it when possible (see Command::mergeWith), so that continuous
+ * interactions only leave one entry. When the commands use more memory
+ * than the budget, the oldest ones are moved to a temporary file and are
+ * reloaded when they are undone or redone.
  */
 class SCORE_LIB_BASE_EXPORT CommandStack final : public QObject
 {
@@ -63,18 +75,28 @@ public:
   const score::Command* command(int index) const;
   int currentIndex() const;
 
-  void markCurrentIndexAsSaved();
+  /**
+   * @brief Approximate memory used by the command at this index, in bytes
+   *
+   * Commands moved to disk only count for their bookkeeping.
+   */
+  std::size_t memoryUsage(int index) const;
 
-  bool isAtSavedIndex() const;
+  //! Approximate memory used by all the commands of the stack, in bytes.
+  std::size_t memoryUsage() const;
 
-  QStack<score::Command*>& undoable()
+  //! The oldest commands are moved to disk when the stack uses more
+  //! memory than this. 0 means no limit.
+  void setMemoryBudget(std::size_t bytes);
+  std::size_t memoryBudget() const noexcept
   {
-    return m_undoable;
-  }
-  QStack<score::Command*>& redoable()
-  {
-    return m_redoable;
+    return m_memoryBudget;
   }
+
+  void markCurrentIndexAsSaved();
+
+  bool isAtSavedIndex() const;
+
   const QStack<score::Command*>& undoable() const
   {
     return m_undoable;
@@ -91,7 +113,8 @@ public:
 
   /**
    * @brief Emitted when a command was pushed on the stack
-   * @param cmd the command that was pushed
+   * @param cmd the command now at the top of the stack: when the pushed
+   * command was merged into the previous one, it is the previous one.
    */
   void localCommand(score::Command* cmd)
       E_SIGNAL(SCORE_LIB_BASE_EXPORT, localCommand, cmd)
@@ -222,12 +245,42 @@ public:
 
   void setSavedIndex(int index);
 
+  /**
+   * @brief Replaces all the commands of the stack, e.g. to restore a document
+   *
+   * The commands of undoable must already have been applied to the document.
+   * They are accounted for in the memory budget as if they had been pushed.
+   */
+  void restore(
+      std::vector<std::unique_ptr<score::Command>> undoable,
+      std::vector<std::unique_ptr<score::Command>> redoable);
+
 private:
+  score::Command* pushImpl(score::Command* cmd);
+  bool tryMerge(score::Command& cmd);
+  void clearRedoable();
+
+  std::size_t accountFor(const score::Command* cmd) const;
+  void forget(const score::Command* cmd);
+  void settleTop();
+  void spill();
+
   QStack<score::Command*> m_undoable;
   QStack<score::Command*> m_redoable;
 
   int m_savedIndex{};
 
+  // Memory accounting
+  mutable score::hash_map<const score::Command*, std::size_t> m_sizes;
+  mutable std::size_t m_memory{};
+  std::size_t m_memoryBudget{};
+
+  // The commands of m_undoable before this index are on disk
+  int m_spillIndex{};
+  std::unique_ptr<QTemporaryFile> m_spillFile;
+
+  QElapsedTimer m_lastPush;
+
   DocumentValidator m_checker;
   const score::DocumentContext& m_ctx;
 };
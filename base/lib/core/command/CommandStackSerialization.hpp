@@ -5,6 +5,9 @@
 #include <score/serialization/DataStreamVisitor.hpp>
 
 #include <core/command/CommandStack.hpp>
+
+#include <memory>
+#include <vector>
 namespace score
 {
 template <typename RedoFun>
@@ -18,26 +21,30 @@ void loadCommandStack(
 
   writer.checkDelimiter();
 
-  stack.undoable().clear();
-  stack.redoable().clear();
-
-  stack.updateStack([&]() {
-    stack.setSavedIndex(-1);
-
-    for (const auto& elt : undoStack)
-    {
-      auto cmd = components.instantiateUndoCommand(elt);
-
-      redo_fun(cmd);
-      stack.undoable().push(cmd);
-    }
-
-    for (const auto& elt : redoStack)
-    {
-      auto cmd = components.instantiateUndoCommand(elt);
-
-      stack.redoable().push(cmd);
-    }
-  });
+  std::vector<std::unique_ptr<score::Command>> undoable, redoable;
+  undoable.reserve(undoStack.size());
+  redoable.reserve(redoStack.size());
+
+  for (const auto& elt : undoStack)
+  {
+    std::unique_ptr<score::Command> cmd{
+        components.instantiateUndoCommand(elt)};
+    if (!cmd)
+      continue;
+
+    redo_fun(cmd.get());
+    undoable.push_back(std::move(cmd));
+  }
+
+  for (const auto& elt : redoStack)
+  {
+    std::unique_ptr<score::Command> cmd{
+        components.instantiateUndoCommand(elt)};
+    if (cmd)
+      redoable.push_back(std::move(cmd));
+  }
+
+  // Goes through the stack so that the commands count in its memory budget
+  stack.restore(std::move(undoable), std::move(redoable));
 }
 }
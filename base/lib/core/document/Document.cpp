@@ -90,11 +90,19 @@ void Document::init()
       [&](const Selection& s) {
         Selection filtered = s;
         filtered.removeAll(nullptr);
+
+        // The stack also notifies when e.g. an unselected object is removed:
+        // in that case there is nothing to update.
+        const SelectionDelta delta{m_currentSelection, filtered};
+        if (delta.empty())
+          return;
+        m_currentSelection = filtered;
+
         for (auto& panel : m_context.app.panels())
         {
-          panel.setNewSelection(filtered);
+          panel.setNewSelection(filtered, delta);
         }
-        m_presenter->setNewSelection(filtered);
+        m_presenter->setNewSelection(filtered, delta);
       });
 
   m_documentUpdateTimer.setInterval(16);
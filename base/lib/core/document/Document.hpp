@@ -144,6 +144,7 @@ private:
   CommandStack m_commandStack;
 
   SelectionStack m_selectionStack;
+  Selection m_currentSelection;
   ObjectLocker m_objectLocker;
   FocusManager m_focus;
   QTimer m_documentUpdateTimer;
@@ -22,8 +22,9 @@ DocumentPresenter::DocumentPresenter(
 {
 }
 
-void DocumentPresenter::setNewSelection(const Selection& s)
+void DocumentPresenter::setNewSelection(
+    const Selection& s, const SelectionDelta& delta)
 {
-  m_presenter->setNewSelection(s);
+  m_presenter->setNewSelection(s, delta);
 }
 }
@@ -5,6 +5,7 @@
 #include <wobjectdefs.h>
 
 class Selection;
+struct SelectionDelta;
 namespace score
 {
 struct DocumentContext;
@@ -28,7 +29,7 @@ public:
     return m_presenter;
   }
 
-  void setNewSelection(const Selection& s);
+  void setNewSelection(const Selection& s, const SelectionDelta& delta);
 
   DocumentView& m_view;
   const DocumentModel& m_model;
@@ -196,25 +196,58 @@ Document::Document(
   }
 }
 
+namespace
+{
+// Reads a QByteArray written by QDataStream as a view on the source data,
+// so that a mapped file is never copied.
+QByteArray readByteArrayView(QDataStream& s, const QByteArray& data)
+{
+  quint32 len{};
+  s >> len;
+  if (len == 0xFFFFFFFF || s.status() != QDataStream::Ok)
+    return {};
+
+  const auto pos = s.device()->pos();
+  if (pos + len > data.size() || s.skipRawData(len) != int(len))
+  {
+    s.setStatus(QDataStream::ReadPastEnd);
+    return {};
+  }
+  return QByteArray::fromRawData(data.constData() + pos, len);
+}
+}
+
 void DocumentModel::loadDocumentAsByteArray(
     score::DocumentContext& ctx, const QByteArray& data,
     DocumentDelegateFactory& fact)
 {
-  // Deserialize the first parts
+  // Deserialize the first parts, as views on data
   QByteArray doc;
   QVector<QPair<QByteArray, QByteArray>> documentPluginModels;
   QByteArray hash;
 
   QDataStream wr{data};
-  wr >> doc >> documentPluginModels >> hash;
+  doc = readByteArrayView(wr, data);
+
+  quint32 plug_count{};
+  wr >> plug_count;
+  for (quint32 i = 0; i < plug_count && wr.status() == QDataStream::Ok; i++)
+  {
+    auto before = readByteArrayView(wr, data);
+    auto after = readByteArrayView(wr, data);
+    documentPluginModels.push_back({std::move(before), std::move(after)});
+  }
+
+  // The hash is computed on everything that was written before it
+  const auto hashed = wr.device()->pos();
+  wr >> hash;
 
   // Perform hash verification
-  QByteArray verif_arr;
-  QDataStream writer(&verif_arr, QIODevice::WriteOnly);
-  writer << doc << documentPluginModels;
-  if (QCryptographicHash::hash(
-          verif_arr, QCryptographicHash::Algorithm::Sha512)
-      != hash)
+  if (wr.status() != QDataStream::Ok
+      || QCryptographicHash::hash(
+             QByteArray::fromRawData(data.constData(), hashed),
+             QCryptographicHash::Algorithm::Sha512)
+             != hash)
   {
     throw std::runtime_error("Invalid file.");
   }
@@ -22,6 +22,10 @@
 #include <QStandardPaths>
 #include <QVariant>
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <typeinfo>
 #include <utility>
 
 #if defined(_WIN32)
@@ -240,6 +244,45 @@ void loadPluginsInAllFolders(
 #endif
 }
 
+void parallelFor(std::size_t count, const std::function<void(std::size_t)>& f)
+{
+  static const bool sequential
+      = qEnvironmentVariableIsSet("SCORE_SEQUENTIAL_STARTUP");
+
+  std::size_t threads = std::min<std::size_t>(
+      count, std::max(1u, std::thread::hardware_concurrency()));
+#if defined(__EMSCRIPTEN__)
+  threads = 1;
+#endif
+  if (sequential || threads <= 1)
+  {
+    for (std::size_t i = 0; i < count; i++)
+      f(i);
+    return;
+  }
+
+  std::atomic_size_t next{};
+  auto work = [&] {
+    for (std::size_t i = next++; i < count; i = next++)
+      f(i);
+  };
+
+  std::vector<std::thread> workers;
+  workers.reserve(threads - 1);
+  for (std::size_t t = 1; t < threads; t++)
+    workers.emplace_back(work);
+  work();
+  for (auto& t : workers)
+    t.join();
+}
+
+QString addonName(const score::Addon& addon)
+{
+  if (!addon.name.isEmpty())
+    return addon.name;
+  return score::StartupTrace::typeName(typeid(*addon.plugin));
+}
+
 optional<score::Addon> makeAddon(
     const QString& addon_path, const QJsonObject& json_addon,
     const std::vector<score::Addon>& availablePlugins)
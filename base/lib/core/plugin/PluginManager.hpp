@@ -7,6 +7,7 @@
 #include <score/plugins/qt_interfaces/FactoryInterface_QtInterface.hpp>
 #include <score/plugins/qt_interfaces/GUIApplicationPlugin_QtInterface.hpp>
 #include <score/plugins/qt_interfaces/PluginRequirements_QtInterface.hpp>
+#include <score/tools/StartupTrace.hpp>
 #include <score/tools/std/Optional.hpp>
 
 #include <core/plugin/PluginDependencyGraph.hpp>
@@ -17,6 +18,8 @@
 
 #include <score_lib_base_export.h>
 
+#include <functional>
+#include <typeinfo>
 #include <vector>
 namespace score
 {
@@ -58,41 +61,87 @@ ossia::optional<score::Addon> makeAddon(
     const QString& addon_path, const QJsonObject& json_addon,
     const std::vector<score::Addon>& availablePlugins);
 
+//! Name of the add-on in the startup traces
+SCORE_LIB_BASE_EXPORT QString addonName(const score::Addon& addon);
+
+/**
+ * @brief Calls f(0), ..., f(count - 1) on the threads of the machine
+ *
+ * The calling thread takes part in the work. Everything runs on the calling
+ * thread if the SCORE_SEQUENTIAL_STARTUP environment variable is set, so
+ * that the startup traces of both ways can be compared.
+ */
+SCORE_LIB_BASE_EXPORT void
+parallelFor(std::size_t count, const std::function<void(std::size_t)>& f);
+
 template <typename Registrar_T>
 void registerPluginsImpl(
     const std::vector<score::Addon>& availablePlugins, Registrar_T& registrar,
     const score::GUIApplicationContext& context)
 {
   // Load what the plug-ins have to offer.
+  std::vector<std::pair<const score::Addon*, FactoryInterface_QtInterface*>>
+      factories_plugins;
   for (const score::Addon& addon : availablePlugins)
   {
     auto commands_plugin
         = dynamic_cast<CommandFactory_QtInterface*>(addon.plugin);
     if (commands_plugin)
     {
+      score::StartupTrace::Scope _{
+          "commands", [&] { return addonName(addon); }};
       registrar.registerCommands(commands_plugin->make_commands());
     }
 
     auto factories_plugin
         = dynamic_cast<FactoryInterface_QtInterface*>(addon.plugin);
     if (factories_plugin)
-    {
-      for (auto& factory_family : registrar.components().factories)
+      factories_plugins.emplace_back(&addon, factories_plugin);
+  }
+
+  std::vector<std::pair<score::InterfaceKey, score::InterfaceListBase*>>
+      families;
+  for (auto& factory_family : registrar.components().factories)
+    families.emplace_back(
+        factory_family.first, factory_family.second.get());
+
+  // Register core factories.
+  // A family only holds its own factories, thus the families are filled in
+  // parallel; in each of them, the plug-ins are still visited in order.
+  {
+    score::StartupTrace::Scope _{"factories", "Core factories"};
+    const score::ApplicationContext& base_ctx = context;
+    parallelFor(families.size(), [&](std::size_t i) {
+      auto& family = families[i];
+      for (auto& plug : factories_plugins)
       {
-        const score::ApplicationContext& base_ctx = context;
-        // Register core factories
+        score::StartupTrace::Scope _{"factories", [&] {
+          return addonName(*plug.first) + " / "
+                 + score::StartupTrace::typeName(typeid(*family.second));
+        }};
         for (auto&& new_factory :
-             factories_plugin->factories(base_ctx, factory_family.first))
+             plug.second->factories(base_ctx, family.first))
         {
-          factory_family.second->insert(std::move(new_factory));
+          family.second->insert(std::move(new_factory));
         }
+      }
+    });
+  }
 
-        // Register GUI factories
-        for (auto&& new_factory :
-             factories_plugin->guiFactories(context, factory_family.first))
-        {
-          factory_family.second->insert(std::move(new_factory));
-        }
+  // Register GUI factories, which may create widgets or pixmaps
+  // and thus stay on the GUI thread.
+  for (auto& plug : factories_plugins)
+  {
+    for (auto& family : families)
+    {
+      score::StartupTrace::Scope _{"gui factories", [&] {
+        return addonName(*plug.first) + " / "
+               + score::StartupTrace::typeName(typeid(*family.second));
+      }};
+      for (auto&& new_factory :
+           plug.second->guiFactories(context, family.first))
+      {
+        family.second->insert(std::move(new_factory));
       }
     }
   }
@@ -109,6 +158,8 @@ void registerPlugins(
         = dynamic_cast<ApplicationPlugin_QtInterface*>(addon.plugin);
     if (ctrl_plugin)
     {
+      score::StartupTrace::Scope _{
+          "application plugins", [&] { return addonName(addon); }};
       if (auto plug = ctrl_plugin->make_applicationPlugin(context))
         registrar.registerApplicationPlugin(plug);
       if (auto plug = ctrl_plugin->make_guiApplicationPlugin(context))
@@ -128,6 +179,8 @@ void registerPlugins(
 template <typename Registrar_T, typename Context_T>
 void loadPlugins(Registrar_T& registrar, const Context_T& context)
 {
+  score::StartupTrace::Scope _{"plugins", "Load plug-ins"};
+
   // Here, the plug-ins that are effectively loaded.
   std::vector<score::Addon> availablePlugins;
 
@@ -141,8 +194,11 @@ void loadPlugins(Registrar_T& registrar, const Context_T& context)
     availablePlugins.push_back(std::move(addon));
   }
 
-  loadPluginsInAllFolders(availablePlugins);
-  loadAddonsInAllFolders(availablePlugins);
+  {
+    score::StartupTrace::Scope _{"plugins", "Load plug-in libraries"};
+    loadPluginsInAllFolders(availablePlugins);
+    loadAddonsInAllFolders(availablePlugins);
+  }
 
   // First bring in the plugin objects
   registrar.registerAddons(availablePlugins);
@@ -159,6 +215,8 @@ void loadPlugins(Registrar_T& registrar, const Context_T& context)
 
     if (facfam_interface)
     {
+      score::StartupTrace::Scope _{
+          "factory families", [&] { return addonName(addon); }};
       for (auto&& elt : facfam_interface->factoryFamilies())
       {
         registrar.registerFactory(std::move(elt));
@@ -10,6 +10,26 @@
 #include <score/serialization/DataStreamVisitor.hpp>
 
 #include <QDataStream>
+#include <QIODevice>
+
+namespace
+{
+// Counts the bytes written to it without storing them
+class SizeCounter final : public QIODevice
+{
+public:
+  qint64 written{};
+
+private:
+  qint64 readData(char*, qint64) override { return -1; }
+  qint64 writeData(const char*, qint64 len) override
+  {
+    written += len;
+    return len;
+  }
+};
+}
+
 namespace score
 {
 Dispatcher::~Dispatcher() = default;
@@ -31,6 +51,26 @@ QByteArray Command::serialize() const
   return arr;
 }
 
+std::size_t Command::serializedSize() const
+{
+  SizeCounter dev;
+  dev.open(QIODevice::WriteOnly | QIODevice::Unbuffered);
+  {
+    QDataStream s(&dev);
+    s.setVersion(QDataStream::Qt_5_6);
+
+    DataStreamInput inp{s};
+    serializeImpl(inp);
+  }
+
+  return std::size_t(dev.written);
+}
+
+bool Command::mergeWith(const Command&)
+{
+  return false;
+}
+
 void Command::deserialize(const QByteArray& arr)
 {
   QDataStream s(arr);
@@ -4,6 +4,8 @@
 #include <QByteArray>
 #include <QString>
 
+#include <cstddef>
+
 namespace score
 {
 struct ApplicationContext;
@@ -38,8 +40,21 @@ public:
   QByteArray serialize() const;
   void deserialize(const QByteArray&);
 
+  //! Size of serialize(), computed without allocating it
+  std::size_t serializedSize() const;
+
   virtual QString description() const = 0;
 
+  /**
+   * @brief Merges the command pushed right after this one
+   *
+   * Used by the command stack to coalesce the consecutive commands of a
+   * same interaction: `next` always has the same key as this command.
+   * When this returns true, `next` is discarded and this command must
+   * redo the changes of both, and undo to the state before itself.
+   */
+  virtual bool mergeWith(const Command& next);
+
 protected:
   virtual void serializeImpl(DataStreamInput&) const = 0;
   virtual void deserializeImpl(DataStreamOutput&) = 0;
@@ -19,6 +19,17 @@ void score::PropertyCommand::redo(const score::DocumentContext& ctx) const
       m_property.toUtf8().constData(), m_new);
 }
 
+bool score::PropertyCommand::mergeWith(const Command& next)
+{
+  auto other = dynamic_cast<const PropertyCommand*>(&next);
+  if (!other || !(other->m_path == m_path)
+      || other->m_property != m_property)
+    return false;
+
+  m_new = other->m_new;
+  return true;
+}
+
 void score::PropertyCommand::serializeImpl(DataStreamInput& s) const
 {
   s << m_path << m_property << m_old << m_new;
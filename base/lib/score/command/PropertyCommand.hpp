@@ -45,6 +45,8 @@ public:
     m_new = std::move(newval);
   }
 
+  bool mergeWith(const Command& next) override;
+
 protected:
   void serializeImpl(DataStreamInput&) const final override;
   void deserializeImpl(DataStreamOutput&) final override;
@@ -94,6 +96,16 @@ public:
     (m_path.find(ctx).*T::set())(m_new);
   }
 
+  bool mergeWith(const score::Command& next) override
+  {
+    auto other = dynamic_cast<const PropertyCommand_T*>(&next);
+    if (!other || !(other->m_path == m_path))
+      return false;
+
+    m_new = other->m_new;
+    return true;
+  }
+
 private:
   void serializeImpl(DataStreamInput& s) const final override
   {
@@ -6,6 +6,7 @@
 #include <wobjectdefs.h>
 
 class Selection;
+struct SelectionDelta;
 namespace score
 {
 class DocumentDelegateModel;
@@ -23,7 +24,8 @@ public:
   virtual ~DocumentDelegatePresenter();
 
 public:
-  virtual void setNewSelection(const Selection& s) = 0;
+  virtual void
+  setNewSelection(const Selection& s, const SelectionDelta& delta) = 0;
   W_SLOT(setNewSelection);
 
 protected:
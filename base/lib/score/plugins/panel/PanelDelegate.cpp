@@ -46,7 +46,8 @@ const GUIApplicationContext& PanelDelegate::context() const
   return m_context;
 }
 
-void PanelDelegate::setNewSelection(const Selection& s)
+void PanelDelegate::setNewSelection(
+    const Selection& s, const SelectionDelta& delta)
 {
 }
 
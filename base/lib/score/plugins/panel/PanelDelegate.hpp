@@ -7,6 +7,7 @@
 
 #include <score_lib_base_export.h>
 class Selection;
+struct SelectionDelta;
 namespace score
 {
 struct GUIApplicationContext;
@@ -79,8 +80,10 @@ public:
    * change in score
    *
    * @param s The new selection.
+   * @param delta The objects added to and removed from the selection.
    */
-  virtual void setNewSelection(const Selection& s);
+  virtual void
+  setNewSelection(const Selection& s, const SelectionDelta& delta);
 
 protected:
   /**
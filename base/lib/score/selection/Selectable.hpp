@@ -37,6 +37,13 @@ public:
     }
   }
 
+  //! Like set, but without sending a signal if the value does not change.
+  void update(bool b) const
+  {
+    if (m_val != b)
+      set(b);
+  }
+
   void set(bool b) const
       E_SIGNAL(SCORE_LIB_BASE_EXPORT, set, b) void changed(bool b)
           E_SIGNAL(SCORE_LIB_BASE_EXPORT, changed, b)
@@ -1,73 +1,197 @@
 #pragma once
 #include <score/model/IdentifiedObjectAbstract.hpp>
 
+#include <QList>
 #include <QPointer>
 
 #include <wobjectdefs.h>
 
+#include <tsl/hopscotch_map.h>
+
+#include <initializer_list>
+#include <iterator>
+
 /**
  * A selection is a set of objects.
+ *
+ * The objects are kept in the order in which they were selected,
+ * and indexed by address so that membership tests are constant-time.
  */
-class Selection final : private QList<QPointer<const IdentifiedObjectAbstract>>
+class Selection final
 {
-  using base_type = QList<QPointer<const IdentifiedObjectAbstract>>;
-
 public:
-  using base_type::at;
-  using base_type::base_type;
-  using base_type::begin;
-  using base_type::cbegin;
-  using base_type::cend;
-  using base_type::clear;
-  using base_type::constBegin;
-  using base_type::constEnd;
-  using base_type::contains;
-  using base_type::empty;
-  using base_type::end;
-  using base_type::erase;
-  using base_type::removeAll;
-  using base_type::size;
+  using value_type = QPointer<const IdentifiedObjectAbstract>;
+  using container_type = QList<value_type>;
+  using const_iterator = container_type::const_iterator;
+  using iterator = const_iterator;
+
+  Selection() = default;
+  Selection(const Selection&) = default;
+  Selection(Selection&&) = default;
+  Selection& operator=(const Selection&) = default;
+  Selection& operator=(Selection&&) = default;
+
+  Selection(std::initializer_list<const IdentifiedObjectAbstract*> objs)
+  {
+    for (auto obj : objs)
+      append(obj);
+  }
 
   static Selection
   fromList(const QList<const IdentifiedObjectAbstract*>& other)
   {
     Selection s;
+    s.reserve(other.size());
     for (auto elt : other)
     {
-      s.base_type::append(elt);
+      s.append(elt);
     }
     return s;
   }
 
-  void append(const base_type::value_type& obj)
+  const value_type& at(int i) const
+  {
+    return m_list.at(i);
+  }
+  int size() const noexcept
+  {
+    return m_list.size();
+  }
+  bool empty() const noexcept
+  {
+    return m_list.empty();
+  }
+  void reserve(int n)
+  {
+    m_list.reserve(n);
+    m_index.reserve(n);
+  }
+
+  const_iterator begin() const noexcept
+  {
+    return m_list.cbegin();
+  }
+  const_iterator end() const noexcept
+  {
+    return m_list.cend();
+  }
+  const_iterator cbegin() const noexcept
+  {
+    return m_list.cbegin();
+  }
+  const_iterator cend() const noexcept
+  {
+    return m_list.cend();
+  }
+  const_iterator constBegin() const noexcept
+  {
+    return m_list.cbegin();
+  }
+  const_iterator constEnd() const noexcept
+  {
+    return m_list.cend();
+  }
+
+  bool contains(const IdentifiedObjectAbstract* obj) const noexcept
   {
-    if (!contains(obj))
-      base_type::append(obj);
+    // An object which was destroyed may still be in the index: its
+    // pointer is null, so that another object reusing the address does not
+    // look selected.
+    auto it = m_index.find(obj);
+    return it != m_index.end() && !it->second.isNull();
   }
 
-  void append(base_type::value_type&& obj)
+  void append(const IdentifiedObjectAbstract* obj)
   {
-    if (!contains(obj))
-      base_type::append(std::move(obj));
+    if (obj && !contains(obj))
+    {
+      m_index[obj] = obj;
+      m_list.append(obj);
+    }
+  }
+
+  const_iterator erase(const_iterator it)
+  {
+    const auto idx = std::distance(m_list.cbegin(), it);
+    if (auto obj = it->data())
+      m_index.erase(obj);
+    return m_list.erase(m_list.begin() + idx);
+  }
+
+  int removeAll(const IdentifiedObjectAbstract* obj)
+  {
+    if (obj)
+    {
+      auto it = m_index.find(obj);
+      if (it == m_index.end())
+        return 0;
+      m_index.erase(it);
+    }
+    return m_list.removeAll(obj);
+  }
+
+  bool removeOne(const IdentifiedObjectAbstract* obj)
+  {
+    return removeAll(obj) > 0;
+  }
+
+  void clear() noexcept
+  {
+    m_list.clear();
+    m_index.clear();
+  }
+
+  //! The objects of this selection which are not in other
+  Selection difference(const Selection& other) const
+  {
+    Selection s;
+    for (const auto& obj : m_list)
+      if (!other.contains(obj))
+        s.append(obj);
+    return s;
   }
 
   bool operator==(const Selection& other) const
   {
-    return base_type::operator!=(static_cast<const base_type&>(other));
+    return m_list == other.m_list;
   }
 
   bool operator!=(const Selection& other) const
   {
-    return base_type::operator!=(static_cast<const base_type&>(other));
+    return m_list != other.m_list;
   }
 
   QList<const IdentifiedObjectAbstract*> toList() const
   {
     QList<const IdentifiedObjectAbstract*> l;
-    for (const auto& elt : *this)
+    l.reserve(m_list.size());
+    for (const auto& elt : m_list)
       l.push_back(elt);
     return l;
   }
+
+private:
+  container_type m_list;
+  tsl::hopscotch_map<const IdentifiedObjectAbstract*, value_type> m_index;
+};
+
+/**
+ * @brief The changes between two selections
+ */
+struct SelectionDelta
+{
+  Selection added;
+  Selection removed;
+
+  SelectionDelta(const Selection& before, const Selection& after)
+      : added{after.difference(before)}, removed{before.difference(after)}
+  {
+  }
+
+  bool empty() const noexcept
+  {
+    return added.empty() && removed.empty();
+  }
 };
 
 template <typename T>
@@ -131,3 +255,4 @@ inline Selection filterSelections(
 }
 
 W_REGISTER_ARGTYPE(Selection)
+W_REGISTER_ARGTYPE(SelectionDelta)
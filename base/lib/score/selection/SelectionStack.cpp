@@ -8,8 +8,6 @@
 #include <score/selection/Selection.hpp>
 #include <score/tools/Todo.hpp>
 
-#include <ossia/detail/flat_set.hpp>
-
 #include <QList>
 #include <QPointer>
 #include <QVector>
@@ -17,6 +15,8 @@
 
 #include <wobjectimpl.h>
 
+#include <tsl/hopscotch_set.h>
+
 #include <algorithm>
 W_OBJECT_IMPL(score::SelectionStack)
 W_OBJECT_IMPL(Selectable)
@@ -133,8 +133,7 @@ void SelectionStack::prune(IdentifiedObjectAbstract* p)
     for (int i = 0; i < n; i++)
     {
       Selection& sel = m_unselectable[i];
-      // OPTIMIZEME should be removeOne
-      sel.removeAll(p);
+      sel.removeOne(p);
 
       for (auto it = sel.begin(); it != sel.end();)
       {
@@ -159,7 +158,7 @@ void SelectionStack::prune(IdentifiedObjectAbstract* p)
     for (int i = 0; i < n; i++)
     {
       Selection& sel = m_reselectable[i];
-      sel.removeAll(p);
+      sel.removeOne(p);
       for (auto it = sel.begin(); it != sel.end();)
       {
         if ((*it).isNull())
@@ -195,7 +194,7 @@ void SelectionStack::prune(IdentifiedObjectAbstract* p)
 
 void SelectionStack::pruneConnections()
 {
-  ossia::flat_set<const IdentifiedObjectAbstract*> present;
+  tsl::hopscotch_set<const IdentifiedObjectAbstract*> present;
   for(auto& sel : m_unselectable)
   {
     for(auto& obj : sel)
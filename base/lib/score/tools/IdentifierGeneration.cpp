@@ -2,8 +2,11 @@
 // it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
 #include "IdentifierGeneration.hpp"
 
+#include <tsl/hopscotch_set.h>
+
 #include <cstdint>
 #include <limits>
+#include <numeric>
 #include <random>
 
 namespace score
@@ -47,4 +50,34 @@ int32_t random_id_generator::getRandomId()
 }
 
 #endif
+
+std::vector<int32_t> random_id_generator::getNextIds(
+    const std::vector<int32_t>& ids, std::size_t n)
+{
+  tsl::hopscotch_set<int32_t> used;
+  used.reserve(ids.size() + n);
+  used.insert(ids.begin(), ids.end());
+
+  std::vector<int32_t> res;
+  res.reserve(n);
+  while (res.size() < n)
+  {
+    const int32_t id = getRandomId();
+    if (used.insert(id).second)
+      res.push_back(id);
+  }
+  return res;
+}
+
+std::vector<int32_t> linear_id_generator::getNextIds(
+    const std::vector<int32_t>& ids, std::size_t n)
+{
+  int32_t next = getFirstId();
+  if (!ids.empty())
+    next = *std::max_element(ids.begin(), ids.end()) + 1;
+
+  std::vector<int32_t> res(n);
+  std::iota(res.begin(), res.end(), next);
+  return res;
+}
 }
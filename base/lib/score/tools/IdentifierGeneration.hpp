@@ -50,6 +50,16 @@ struct SCORE_LIB_BASE_EXPORT random_id_generator
 
     return id;
   }
+
+  /**
+   * @brief getNextIds
+   * @param ids The existing ids
+   * @param n The number of ids to generate
+   *
+   * @return n distinct ids, none of which are in ids.
+   */
+  static std::vector<int32_t>
+  getNextIds(const std::vector<int32_t>& ids, std::size_t n);
 };
 
 /**
@@ -72,6 +82,9 @@ struct SCORE_LIB_BASE_EXPORT linear_id_generator
       return typename Vector::value_type{getFirstId()};
   }
 
+  static std::vector<int32_t>
+  getNextIds(const std::vector<int32_t>& ids, std::size_t n);
+
 private:
   template <typename T>
   static int32_t getId(const Id<T>& other)
@@ -89,6 +102,19 @@ private:
 };
 
 using id_generator = score::linear_id_generator;
+
+/**
+ * @brief Reserves s new identifiers, none of which are in existing.
+ *
+ * This is linear in the number of ids, unlike calling getStrongId s times.
+ */
+template <typename T>
+std::vector<Id<T>>
+reserveIds(std::size_t s, const std::vector<int32_t>& existing)
+{
+  const auto ids = id_generator::getNextIds(existing, s);
+  return std::vector<Id<T>>(ids.begin(), ids.end());
+}
 }
 template <typename T>
 auto getStrongId(const std::vector<Id<T>>& v)
@@ -141,77 +167,41 @@ auto getStrongId(const Container& v) -> Id<typename Container::value_type>
 template <typename T>
 auto getStrongIdRange(std::size_t s)
 {
-  std::vector<Id<T>> vec;
-  vec.reserve(s);
-  vec.emplace_back(score::id_generator::getFirstId());
-
-  s--;
-  for (std::size_t i = 0; i < s; i++)
-  {
-    vec.push_back(getStrongId(vec));
-  }
-
-  return vec;
+  return score::reserveIds<T>(s, {});
 }
 
 template <typename T, typename Vector>
 auto getStrongIdRange(std::size_t s, const Vector& existing)
 {
-  auto existing_size = existing.size();
-  auto total_size = existing_size + s;
-  std::vector<Id<T>> vec;
-  vec.reserve(total_size);
-
-  // Copy the existing ids
-  std::transform(
-      existing.begin(), existing.end(), std::back_inserter(vec),
-      [](const auto& elt) { return elt.id(); });
-
-  // Then generate the new ones
-  for (std::size_t i = 0; i < s; i++)
-  {
-    vec.push_back(getStrongId(vec));
-  }
+  std::vector<int32_t> ids;
+  ids.reserve(existing.size());
+  for (const auto& elt : existing)
+    ids.push_back(elt.id().val());
 
-  return std::vector<Id<T>>(vec.begin() + existing.size(), vec.end());
+  return score::reserveIds<T>(s, ids);
 }
 
 template <typename T, typename Vector1, typename Vector2>
 static auto getStrongIdRange2(
     std::size_t s, const Vector1& existing1, const Vector2& existing2)
 {
-  std::vector<Id<T>> vec;
-  vec.reserve(s + existing1.size() + existing2.size());
-  std::transform(
-      existing1.begin(), existing1.end(), std::back_inserter(vec),
-      [](const auto& elt) { return elt.id(); });
-  std::transform(
-      existing2.begin(), existing2.end(), std::back_inserter(vec),
-      [](const auto& elt) { return elt->id(); });
-
-  for (std::size_t i = 0; i < s; i++)
-  {
-    vec.push_back(getStrongId(vec));
-  }
-  auto final = std::vector<Id<T>>(
-      vec.begin() + existing1.size() + existing2.size(), vec.end());
-
-  return final;
+  std::vector<int32_t> ids;
+  ids.reserve(existing1.size() + existing2.size());
+  for (const auto& elt : existing1)
+    ids.push_back(elt.id().val());
+  for (const auto& elt : existing2)
+    ids.push_back(elt->id().val());
+
+  return score::reserveIds<T>(s, ids);
 }
 
 template <typename T, typename Vector>
 auto getStrongIdRangePtr(std::size_t s, const Vector& existing)
 {
-  std::vector<Id<T>> vec;
-  vec.reserve(s + existing.size());
-  std::transform(
-      existing.begin(), existing.end(), std::back_inserter(vec),
-      [](const auto& elt) { return elt->id(); });
-
-  for (; s-- > 0;)
-  {
-    vec.push_back(getStrongId(vec));
-  }
+  std::vector<int32_t> ids;
+  ids.reserve(existing.size());
+  for (const auto& elt : existing)
+    ids.push_back(elt->id().val());
 
-  return std::vector<Id<T>>(vec.begin() + existing.size(), vec.end());
+  return score::reserveIds<T>(s, ids);
 }
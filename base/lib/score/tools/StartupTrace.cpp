@@ -0,0 +1,117 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include "StartupTrace.hpp"
+
+#include <QDebug>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+
+#include <boost/core/demangle.hpp>
+
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace score
+{
+namespace
+{
+struct TraceEvent
+{
+  const char* category{};
+  QString name;
+  StartupTrace::clock::time_point start;
+  StartupTrace::clock::time_point end;
+  std::thread::id thread;
+};
+
+struct TraceData
+{
+  const QString file = qEnvironmentVariable("SCORE_STARTUP_TRACE");
+  const StartupTrace::clock::time_point origin = StartupTrace::clock::now();
+
+  std::mutex mutex;
+  std::vector<TraceEvent> events;
+};
+
+TraceData& traceData()
+{
+  static TraceData data;
+  return data;
+}
+}
+
+bool StartupTrace::enabled() noexcept
+{
+  static const bool enabled = !traceData().file.isEmpty();
+  return enabled;
+}
+
+void StartupTrace::record(
+    const char* category, const QString& name, clock::time_point start,
+    clock::time_point end)
+{
+  auto& data = traceData();
+  std::lock_guard lock{data.mutex};
+  data.events.push_back(
+      TraceEvent{category, name, start, end, std::this_thread::get_id()});
+}
+
+QString StartupTrace::typeName(const std::type_info& t)
+{
+  return QString::fromStdString(boost::core::demangle(t.name()));
+}
+
+void StartupTrace::dump()
+{
+  if (!enabled())
+    return;
+
+  auto& data = traceData();
+  std::vector<TraceEvent> events;
+  {
+    std::lock_guard lock{data.mutex};
+    events = data.events;
+  }
+
+  using namespace std::chrono;
+  const auto us = [&](clock::time_point t) {
+    return double(duration_cast<microseconds>(t - data.origin).count());
+  };
+
+  // Threads are numbered in order of appearance
+  std::vector<std::thread::id> threads;
+  QJsonArray arr;
+  for (const auto& e : events)
+  {
+    auto it = std::find(threads.begin(), threads.end(), e.thread);
+    if (it == threads.end())
+      it = threads.insert(it, e.thread);
+
+    QJsonObject obj;
+    obj["name"] = e.name;
+    obj["cat"] = QString::fromLatin1(e.category);
+    obj["ph"] = "X";
+    obj["ts"] = us(e.start);
+    obj["dur"] = us(e.end) - us(e.start);
+    obj["pid"] = 1;
+    obj["tid"] = int(std::distance(threads.begin(), it));
+    arr.push_back(obj);
+  }
+
+  QFile f{data.file};
+  if (!f.open(QIODevice::WriteOnly))
+  {
+    qDebug() << "Could not write the startup trace to" << data.file;
+    return;
+  }
+
+  QJsonObject root;
+  root["traceEvents"] = arr;
+  root["displayTimeUnit"] = "ms";
+  f.write(QJsonDocument{root}.toJson(QJsonDocument::Compact));
+}
+}
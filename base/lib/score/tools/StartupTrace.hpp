@@ -0,0 +1,91 @@
+#pragma once
+#include <QString>
+
+#include <score_lib_base_export.h>
+
+#include <chrono>
+#include <type_traits>
+#include <typeinfo>
+
+namespace score
+{
+/**
+ * @brief Measures the duration of the steps of the startup
+ *
+ * Disabled unless the SCORE_STARTUP_TRACE environment variable is set
+ * to a file path: the measured steps are then written to this file in the
+ * Chrome trace event format when dump() is called, and can be opened
+ * in chrome://tracing or ui.perfetto.dev.
+ *
+ * When disabled, a Scope costs a single boolean check: its name is either
+ * a string literal, or a callable which is only invoked when enabled.
+ */
+class SCORE_LIB_BASE_EXPORT StartupTrace
+{
+public:
+  using clock = std::chrono::steady_clock;
+
+  static bool enabled() noexcept;
+
+  //! Can be called from any thread
+  static void record(
+      const char* category, const QString& name, clock::time_point start,
+      clock::time_point end);
+
+  //! Writes the steps recorded until now to the trace file
+  static void dump();
+
+  //! Readable name of a type, e.g. for the steps of a plug-in
+  static QString typeName(const std::type_info& t);
+
+  /**
+   * @brief Records the time spent until the end of the scope
+   */
+  class Scope
+  {
+  public:
+    Scope(const char* category, const char* name) noexcept
+        : m_category{category}, m_literal{name}
+    {
+      if (enabled())
+        start();
+    }
+
+    //! The name is only computed when tracing is enabled
+    template <
+        typename F, typename = std::enable_if_t<std::is_invocable_v<F&>>>
+    Scope(const char* category, F&& name) : m_category{category}
+    {
+      if (enabled())
+      {
+        m_name = name();
+        start();
+      }
+    }
+
+    ~Scope()
+    {
+      if (m_enabled)
+        record(
+            m_category, m_literal ? QString::fromUtf8(m_literal) : m_name,
+            m_start, clock::now());
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+  private:
+    void start() noexcept
+    {
+      m_start = clock::now();
+      m_enabled = true;
+    }
+
+    const char* m_category{};
+    const char* m_literal{};
+    QString m_name;
+    clock::time_point m_start;
+    bool m_enabled{};
+  };
+};
+}
@@ -0,0 +1,41 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include "player_impl.hpp"
+
+#include <chrono>
+#include <iostream>
+
+// Measures the time taken by the player to load documents, e.g.:
+// player_load_benchmark show.score show.scorebin
+int main(int argc, char** argv)
+{
+  if (argc < 2)
+  {
+    std::cerr << "Usage: " << argv[0] << " <document>...\n";
+    return 1;
+  }
+
+  score::PlayerImpl p{true};
+  p.init();
+
+  constexpr int iterations = 10;
+  for (int i = 1; i < argc; i++)
+  {
+    const auto file = QString::fromLocal8Bit(argv[i]);
+
+    // Warm-up, so that the file is in the page cache
+    p.loadFile(file);
+
+    const auto t0 = std::chrono::steady_clock::now();
+    for (int k = 0; k < iterations; k++)
+      p.loadFile(file);
+    const auto t1 = std::chrono::steady_clock::now();
+
+    const auto ms
+        = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    std::cout << argv[i] << ": " << ms / iterations << " ms\n";
+  }
+
+  p.closeDocument();
+  return 0;
+}
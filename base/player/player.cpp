@@ -188,13 +188,37 @@ void PlayerImpl::loadFile(QString file)
 
   // Load new document
   QFile f(file);
-  f.open(QIODevice::ReadOnly);
-
-  const auto json = QJsonDocument::fromJson(f.readAll()).object();
+  if (!f.open(QIODevice::ReadOnly))
+  {
+    ossia::logger().error("Could not open: {}", file.toStdString());
+    return;
+  }
 
   Scenario::ScenarioDocumentFactory fac;
-  m_currentDocument = std::make_unique<Document>(
-      "Untitled", json, fac, QCoreApplication::instance());
+  if (file.endsWith(".scorebin"))
+  {
+    // Binary documents are read in place from the mapped file: the model
+    // is built without copying nor parsing the whole file beforehand.
+    if (auto data = f.map(0, f.size()))
+    {
+      const auto arr = QByteArray::fromRawData(
+          reinterpret_cast<const char*>(data), f.size());
+      m_currentDocument = std::make_unique<Document>(
+          "Untitled", arr, fac, QCoreApplication::instance());
+      f.unmap(data);
+    }
+    else
+    {
+      m_currentDocument = std::make_unique<Document>(
+          "Untitled", f.readAll(), fac, QCoreApplication::instance());
+    }
+  }
+  else
+  {
+    const auto json = QJsonDocument::fromJson(f.readAll()).object();
+    m_currentDocument = std::make_unique<Document>(
+        "Untitled", json, fac, QCoreApplication::instance());
+  }
 
   setupLoadedDocument();
 }
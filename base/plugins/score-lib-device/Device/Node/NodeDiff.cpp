@@ -0,0 +1,134 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include "NodeDiff.hpp"
+
+#include <score/model/tree/TreeNode.hpp>
+
+#include <QHash>
+
+#include <algorithm>
+#include <iterator>
+
+namespace Device
+{
+bool NodeDiff::empty() const noexcept
+{
+  return !settings && removed.empty() && added.empty() && children.empty();
+}
+
+// Marks the elements of the longest strictly increasing subsequence of seq.
+// Negative elements are ignored.
+static std::vector<bool> longest_increasing(const std::vector<int>& seq)
+{
+  const int n = seq.size();
+
+  // tails[k] is the index of the smallest last element of an increasing
+  // subsequence of length k + 1.
+  std::vector<int> tails;
+  std::vector<int> prev(n, -1);
+  for (int i = 0; i < n; i++)
+  {
+    if (seq[i] < 0)
+      continue;
+
+    auto it = std::lower_bound(
+        tails.begin(), tails.end(), seq[i],
+        [&](int idx, int val) { return seq[idx] < val; });
+    if (it != tails.begin())
+      prev[i] = *std::prev(it);
+
+    if (it == tails.end())
+      tails.push_back(i);
+    else
+      *it = i;
+  }
+
+  std::vector<bool> res(n, false);
+  for (int i = tails.empty() ? -1 : tails.back(); i >= 0; i = prev[i])
+    res[i] = true;
+  return res;
+}
+
+static void diff_children(
+    const Device::Node& before, const Device::Node& after, NodeDiff& res,
+    const std::atomic_bool* canceled)
+{
+  if (canceled && canceled->load(std::memory_order_relaxed))
+    return;
+
+  const int old_count = before.childCount();
+  std::vector<const Device::Node*> old_children;
+  old_children.reserve(old_count);
+  QHash<QString, int> old_rows;
+  old_rows.reserve(old_count);
+  for (const auto& child : before)
+  {
+    // If there are duplicate names only the first one is matched
+    if (!old_rows.contains(child.displayName()))
+      old_rows.insert(child.displayName(), old_children.size());
+    old_children.push_back(&child);
+  }
+
+  // Old row of each new child, or -1 if it is not in the old node
+  std::vector<int> matches;
+  matches.reserve(after.childCount());
+  for (const auto& child : after)
+  {
+    auto it = old_rows.constFind(child.displayName());
+    if (it != old_rows.constEnd()
+        && old_children[*it]->which() == child.which())
+      matches.push_back(*it);
+    else
+      matches.push_back(-1);
+  }
+
+  // Keep as many children as possible while keeping their order
+  const auto kept_new = longest_increasing(matches);
+  std::vector<bool> kept_old(old_count, false);
+
+  int row = 0;
+  for (const auto& child : after)
+  {
+    if (kept_new[row])
+    {
+      const auto& old_child = *old_children[matches[row]];
+      kept_old[matches[row]] = true;
+
+      NodeDiff sub;
+      sub.name = child.displayName();
+      sub.row = row;
+      if (child.is<Device::AddressSettings>()
+          && child.get<Device::AddressSettings>()
+                 != old_child.get<Device::AddressSettings>())
+      {
+        sub.settings = child.get<Device::AddressSettings>();
+      }
+
+      diff_children(old_child, child, sub, canceled);
+      if (!sub.empty())
+        res.children.push_back(std::move(sub));
+    }
+    else
+    {
+      res.added.emplace_back(row, child);
+    }
+    row++;
+  }
+
+  for (int i = 0; i < old_count; i++)
+  {
+    if (!kept_old[i])
+      res.removed.push_back(i);
+  }
+}
+
+NodeDiff diff(
+    const Device::Node& before, const Device::Node& after,
+    const std::atomic_bool* canceled)
+{
+  NodeDiff res;
+  res.name = after.displayName();
+  diff_children(before, after, res, canceled);
+  return res;
+}
+}
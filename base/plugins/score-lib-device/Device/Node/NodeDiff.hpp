@@ -0,0 +1,60 @@
+#pragma once
+#include <Device/Address/AddressSettings.hpp>
+#include <Device/Node/DeviceNode.hpp>
+
+#include <score/tools/std/Optional.hpp>
+
+#include <QString>
+
+#include <score_lib_device_export.h>
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+namespace Device
+{
+/**
+ * @brief Structural difference between two versions of a node hierarchy.
+ *
+ * Children are matched by name. Applying a NodeDiff to an old node
+ * gives the new node :
+ * - its settings are replaced by \p settings if set,
+ * - the children at the rows in \p removed are removed,
+ * - the nodes in \p added are inserted at their row, in ascending order,
+ * - each entry of \p children is applied to the child at its \p row.
+ *
+ * Rows are used rather than names since siblings may share a name.
+ *
+ * Matched children keep their relative order: a child which moved before
+ * another matched child is removed and inserted again.
+ *
+ * It allows to update a tree in place (e.g. the device explorer after
+ * a refresh) without dropping the untouched nodes.
+ */
+struct SCORE_LIB_DEVICE_EXPORT NodeDiff
+{
+  QString name;
+  //! Row in the parent, once the removals and additions are applied.
+  int row{-1};
+  optional<Device::AddressSettings> settings;
+  //! Rows in the old node, in ascending order.
+  std::vector<int> removed;
+  std::vector<std::pair<int, Device::Node>> added;
+  std::vector<NodeDiff> children;
+
+  bool empty() const noexcept;
+};
+
+/**
+ * @brief diff Computes the changes from \p before to \p after.
+ *
+ * The settings of the two root nodes are not compared.
+ * This only reads its arguments and can run outside of the GUI thread.
+ * If \p canceled becomes true the computation stops early: the result is
+ * then incomplete and must be discarded.
+ */
+SCORE_LIB_DEVICE_EXPORT NodeDiff diff(
+    const Device::Node& before, const Device::Node& after,
+    const std::atomic_bool* canceled = nullptr);
+}
@@ -45,6 +45,16 @@ static State::Address ToAddress(const ossia::net::node_base& node)
   return addr;
 }
 
+// Callback set on the parameters which are listened to
+static auto listening_callback(DeviceInterface& self, State::Address addr)
+{
+  return [&self, key = State::InternedAddress{addr},
+          addr = std::move(addr)](const ossia::value& val) {
+    self.valueUpdated(addr, val);
+    self.internedValueUpdated(key, val);
+  };
+}
+
 static ossia::net::node_base*
 getNodeFromPath(const QStringList& path, ossia::net::device_base& dev)
 {
@@ -409,14 +419,15 @@ void DeviceInterface::updateAddress(
   if (auto dev = getDevice())
   {
     ossia::net::node_base* node = getNodeFromPath(currentAddr.path, *dev);
-    bool is_listening = m_callbacks.find(currentAddr) != m_callbacks.end();
+    const State::InternedAddress key{currentAddr};
+    bool is_listening = m_callbacks.find(key) != m_callbacks.end();
 
     if (!settings.value.valid())
     {
       if (is_listening)
       {
         // Remove callbacks
-        auto it = m_callbacks.find(currentAddr);
+        auto it = m_callbacks.find(key);
         if (it != m_callbacks.end())
         {
           it->second.first->remove_callback(it->second.second);
@@ -451,7 +462,7 @@ void DeviceInterface::removeListening_impl(
     ossia::net::node_base& node, State::Address addr)
 {
   // Find & remove our callback
-  auto it = m_callbacks.find(addr);
+  auto it = m_callbacks.find(State::InternedAddress{addr});
   if (it != m_callbacks.end())
   {
     it->second.first->remove_callback(it->second.second);
@@ -472,7 +483,7 @@ void DeviceInterface::removeListening_impl(
     std::vector<State::Address>& vec)
 {
   // Find & remove our callback
-  auto it = m_callbacks.find(addr);
+  auto it = m_callbacks.find(State::InternedAddress{addr});
   if (it != m_callbacks.end())
   {
     it->second.first->remove_callback(it->second.second);
@@ -488,30 +499,19 @@ void DeviceInterface::removeListening_impl(
     removeListening_impl(*child.get(), std::move(sub_addr));
   }
 }
-bool is_parent(const State::Address& parent, const State::Address& child)
-{
-  const auto p_size = parent.path.size();
-  if (child.path.size() < p_size)
-    return false;
-  for (int i = 0; i < p_size; i++)
-  {
-    if (child.path[i] != parent.path[i])
-      return false;
-  }
-  return true;
-}
-
 void DeviceInterface::renameListening_impl(
     const State::Address& parent, const QString& newName)
 {
   // Store the elements that are renamed
-  std::vector<std::pair<State::Address, callback_pair>> saved_elts;
+  const State::InternedAddress parent_key{parent};
+  const auto new_atom = State::AddressSymbols::intern(newName);
+  std::vector<std::pair<State::InternedAddress, callback_pair>> saved_elts;
   for (auto it = m_callbacks.begin(); it != m_callbacks.end();)
   {
-    if (is_parent(parent, it.key()))
+    if (parent_key.isParentOf(it.key()))
     {
-      State::Address addr = it.key();
-      addr.path[parent.path.size() - 1] = newName;
+      State::InternedAddress addr = it.key();
+      addr.setSegment(parent.path.size() - 1, new_atom);
       saved_elts.push_back({std::move(addr), it.value()});
       it = m_callbacks.erase(it);
     }
@@ -525,9 +525,7 @@ void DeviceInterface::renameListening_impl(
   for (auto&& p : std::move(saved_elts))
   {
     p.second.first->replace_callback(
-        p.second.second, [this, addr = p.first](const ossia::value& val) {
-          valueUpdated(addr, val);
-        });
+        p.second.second, listening_callback(*this, p.first.toAddress()));
     m_callbacks.insert(std::move(p));
   }
 }
@@ -801,7 +799,8 @@ void DeviceInterface::setListening(const State::Address& addr, bool b)
   {
     // First check if the address is already listening
     // so that we don't have to go through the tree.
-    auto cb_it = m_callbacks.find(addr);
+    const State::InternedAddress key{addr};
+    auto cb_it = m_callbacks.find(key);
 
     ossia::net::parameter_base* ossia_addr{};
     if (cb_it == m_callbacks.end())
@@ -832,11 +831,10 @@ void DeviceInterface::setListening(const State::Address& addr, bool b)
     {
       if (cb_it == m_callbacks.end())
       {
-        m_callbacks.insert({addr,
-                            {ossia_addr, ossia_addr->add_callback(
-                                             [=](const ossia::value& val) {
-                                               valueUpdated(addr, val);
-                                             })}});
+        m_callbacks.insert(
+            {key,
+             {ossia_addr,
+              ossia_addr->add_callback(listening_callback(*this, addr))}});
       }
 
       valueUpdated(addr, ossia_addr->value());
@@ -863,7 +861,7 @@ std::vector<State::Address> DeviceInterface::listening() const
 
   for (const auto& elt : m_callbacks)
   {
-    addrs.push_back(elt.first);
+    addrs.push_back(elt.first.toAddress());
   }
 
   return addrs;
@@ -1002,7 +1000,7 @@ void DeviceInterface::addressRemoved(const ossia::net::parameter_base& addr)
 {
   auto address = ToAddress(addr.get_node());
 
-  auto cb_it = m_callbacks.find(address);
+  auto cb_it = m_callbacks.find(State::InternedAddress{address});
   if (cb_it != m_callbacks.end())
   {
     m_callbacks.erase(cb_it);
@@ -1,6 +1,7 @@
 #pragma once
 #include <Device/Node/DeviceNode.hpp>
 #include <Device/Protocol/DeviceSettings.hpp>
+#include <State/InternedAddress.hpp>
 
 #include <ossia-qt/device_metatype.hpp>
 
@@ -113,6 +114,10 @@ public:
 
   Nano::Signal<void(const State::Address&, const ossia::value&)> valueUpdated;
 
+  //! Same as valueUpdated, for the listeners which key on interned addresses
+  Nano::Signal<void(const State::InternedAddress&, const ossia::value&)>
+      internedValueUpdated;
+
 public:
   // These signals are emitted if a device changes from the inside
   void pathAdded(const State::Address& arg_1)
@@ -146,7 +151,7 @@ protected:
   using callback_pair = std::pair<
       ossia::net::parameter_base*,
       ossia::callback_container<ossia::value_callback>::iterator>;
-  score::hash_map<State::Address, callback_pair> m_callbacks;
+  score::hash_map<State::InternedAddress, callback_pair> m_callbacks;
 
   void removeListening_impl(ossia::net::node_base& node, State::Address addr);
   void removeListening_impl(
@@ -17,6 +17,21 @@
 W_OBJECT_IMPL(Dataflow::CableItem)
 namespace Dataflow
 {
+namespace
+{
+const QPainterPathStroker& cableStroker()
+{
+  static const QPainterPathStroker cable_stroker{[] {
+    QPen pen;
+    pen.setCapStyle(Qt::PenCapStyle::RoundCap);
+    pen.setJoinStyle(Qt::PenJoinStyle::RoundJoin);
+    pen.setWidthF(3.);
+    return pen;
+  }()};
+  return cable_stroker;
+}
+}
+
 bool CableItem::g_cables_enabled = true;
 
 CableItem::CableItem(
@@ -80,7 +95,7 @@ CableItem::~CableItem()
 
 QRectF CableItem::boundingRect() const
 {
-  return m_path.boundingRect();
+  return m_bounds;
 }
 
 void CableItem::paint(
@@ -129,12 +144,22 @@ void CableItem::paint(
 
 void CableItem::resize()
 {
-  prepareGeometryChange();
-
   if (m_p1 && m_p2)
   {
     auto p1 = m_p1->scenePos();
     auto p2 = m_p2->scenePos();
+    const auto parent = parentItem();
+    const auto parent_pos = parent ? parent->scenePos() : QPointF{};
+    if (!m_dirty && p1 == m_p1Pos && p2 == m_p2Pos
+        && parent_pos == m_parentPos)
+      return;
+
+    m_dirty = false;
+    m_p1Pos = p1;
+    m_p2Pos = p2;
+    m_parentPos = parent_pos;
+
+    prepareGeometryChange();
 
     auto rect = QRectF{p1, p2};
     auto nrect = rect.normalized();
@@ -155,9 +180,15 @@ void CableItem::resize()
   }
   else
   {
+    if (m_path.isEmpty())
+      return;
+
+    prepareGeometryChange();
     m_path = QPainterPath{};
   }
 
+  m_shape = cableStroker().createStroke(m_path);
+  m_bounds = m_shape.boundingRect();
   update();
 }
 
@@ -178,6 +209,7 @@ void CableItem::check()
     m_type = m_p1->port().type;
     if (auto c_o = m_p1->commonAncestorItem(m_p2))
       setParentItem(c_o);
+    m_dirty = true;
     resize();
   }
   else if (isEnabled())
@@ -212,15 +244,7 @@ void CableItem::setTarget(PortItem* p)
 
 QPainterPath CableItem::shape() const
 {
-  static const QPainterPathStroker cable_stroker{[] {
-    QPen pen;
-    pen.setCapStyle(Qt::PenCapStyle::RoundCap);
-    pen.setJoinStyle(Qt::PenJoinStyle::RoundJoin);
-    pen.setWidthF(3.);
-    return pen;
-  }()};
-
-  return cable_stroker.createStroke(m_path);
+  return m_shape;
 }
 
 void CableItem::mousePressEvent(QGraphicsSceneMouseEvent* event)
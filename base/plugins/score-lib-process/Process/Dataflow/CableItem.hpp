@@ -42,6 +42,7 @@ public:
     return static_type();
   }
 
+  //! Recomputes the path if the ports moved since the last call
   void resize();
   void check();
   PortItem* source() const;
@@ -68,6 +69,16 @@ private:
   const score::DocumentContext& m_context;
   QPointer<PortItem> m_p1, m_p2;
   QPainterPath m_path;
+
+  // Cached since hit-testing the cables calls shape() for each of them
+  // whose bounding rect contains the cursor
+  QPainterPath m_shape;
+  QRectF m_bounds;
+
+  // Scene positions of the ports and of the parent for the current path
+  QPointF m_p1Pos, m_p2Pos, m_parentPos;
+  bool m_dirty{true};
+
   Process::PortType m_type{};
   int8_t a1{}, a2{}, a3{}, a4{};
 };
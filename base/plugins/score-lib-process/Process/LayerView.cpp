@@ -12,10 +12,21 @@
 #include <QPainter>
 #include <QStyleOption>
 
+#include <cmath>
+
 #include <wobjectimpl.h>
 W_OBJECT_IMPL(Process::LayerView)
 namespace Process
 {
+namespace
+{
+constexpr qreal tile_width = 256.;
+
+// Tiles further than this from the exposed area are dropped, so that
+// long layers do not keep a pixmap of their whole width.
+constexpr int tile_margin = 8;
+}
+
 HeaderDelegate::~HeaderDelegate()
 {
 }
@@ -66,7 +77,11 @@ QRectF LayerView::boundingRect() const
 void LayerView::paint(
     QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-  paint_impl(painter);
+  // Scaled views, e.g. when printing, are painted directly
+  if (m_cached && !painter->worldTransform().isScaling())
+    paintCached(painter, option->exposedRect);
+  else
+    paint_impl(painter);
 #if defined(SCORE_SCENARIO_DEBUG_RECTS)
   painter->setPen(Qt::green);
   painter->setBrush(Qt::NoBrush);
@@ -80,6 +95,7 @@ void LayerView::setHeight(qreal height) noexcept
   {
     prepareGeometryChange();
     m_height = height;
+    m_tiles.clear();
     heightChanged(height);
   }
 }
@@ -90,10 +106,84 @@ void LayerView::setWidth(qreal width) noexcept
   {
     prepareGeometryChange();
     m_width = width;
+    m_tiles.clear();
     widthChanged(width);
   }
 }
 
+void LayerView::setCached(bool b) noexcept
+{
+  m_cached = b;
+  m_tiles.clear();
+  setFlag(ItemUsesExtendedStyleOption, b);
+}
+
+void LayerView::invalidate()
+{
+  m_tiles.clear();
+  update();
+}
+
+void LayerView::invalidate(const QRectF& rect)
+{
+  const int count = m_tiles.size();
+  const int first = std::max(0, int(rect.left() / tile_width));
+  const int last = std::min(count - 1, int(rect.right() / tile_width));
+  for (int i = first; i <= last; i++)
+    m_tiles[i] = QPixmap{};
+  update(rect);
+}
+
+void LayerView::paintCached(QPainter* painter, QRectF exposed)
+{
+  const qreal scale = painter->device()->devicePixelRatioF();
+  if (scale != m_tileScale)
+  {
+    m_tiles.clear();
+    m_tileScale = scale;
+  }
+
+  const int count = std::ceil(m_width / tile_width);
+  m_tiles.resize(count);
+  if (count == 0 || m_height <= 0.)
+    return;
+
+  if (exposed.isEmpty())
+    exposed = boundingRect();
+
+  const int first = std::max(0, int(exposed.left() / tile_width));
+  const int last = std::min(count - 1, int(exposed.right() / tile_width));
+  for (int i = first; i <= last; i++)
+  {
+    const qreal x = i * tile_width;
+    auto& tile = m_tiles[i];
+    if (tile.isNull())
+      tile = renderTile(*painter, x, scale);
+    painter->drawPixmap(QPointF{x, 0.}, tile);
+  }
+
+  for (int i = 0; i < first - tile_margin; i++)
+    m_tiles[i] = QPixmap{};
+  for (int i = last + tile_margin + 1; i < count; i++)
+    m_tiles[i] = QPixmap{};
+}
+
+QPixmap
+LayerView::renderTile(const QPainter& painter, qreal x, qreal scale) const
+{
+  const qreal w = std::min(tile_width, m_width - x);
+  QPixmap tile{int(std::ceil(w * scale)), int(std::ceil(m_height * scale))};
+  tile.setDevicePixelRatio(scale);
+  tile.fill(Qt::transparent);
+
+  QPainter p{&tile};
+  p.setRenderHints(painter.renderHints());
+  p.translate(-x, 0.);
+  p.setClipRect(QRectF{x, 0., w, m_height});
+  paint_impl(&p);
+  return tile;
+}
+
 QPixmap LayerView::pixmap() noexcept
 {
   // Retrieve the bounding rect
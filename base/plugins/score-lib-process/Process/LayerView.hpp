@@ -3,12 +3,15 @@
 
 #include <QGraphicsItem>
 #include <QGraphicsSceneDragDropEvent>
+#include <QPixmap>
 #include <QRect>
 #include <QtGlobal>
 
 #include <score_lib_process_export.h>
 #include <wobjectdefs.h>
 
+#include <vector>
+
 class QPainter;
 class QStyleOptionGraphicsItem;
 class QWidget;
@@ -78,12 +81,34 @@ protected:
   virtual void heightChanged(qreal);
   virtual void widthChanged(qreal);
 
+  /**
+   * @brief Keep the rendering of paint_impl in pixmap tiles
+   *
+   * For layers which are expensive to paint: scrolling, or repainting
+   * the layer because of the play cursor, then only draws the tiles.
+   * The tiles are dropped when the layer is resized ; the layer must call
+   * invalidate() instead of update() when what it paints changes.
+   *
+   * paint_impl must then not depend on the visible part of the layer,
+   * but it may only paint what is in the clip of the painter: the tile.
+   */
+  void setCached(bool) noexcept;
+  void invalidate();
+  void invalidate(const QRectF& rect);
+
   void hoverEnterEvent(QGraphicsSceneHoverEvent* event) override;
   void hoverLeaveEvent(QGraphicsSceneHoverEvent* event) override;
 
 private:
+  void paintCached(QPainter* painter, QRectF exposed);
+  QPixmap renderTile(const QPainter& painter, qreal x, qreal scale) const;
+
   qreal m_height{};
   qreal m_width{};
+
+  std::vector<QPixmap> m_tiles;
+  qreal m_tileScale{};
+  bool m_cached{};
 };
 
 class SCORE_LIB_PROCESS_EXPORT MiniLayer
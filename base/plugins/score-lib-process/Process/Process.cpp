@@ -160,6 +160,12 @@ void ProcessModel::setSelection(const Selection& s) const noexcept
 {
 }
 
+void ProcessModel::changeSelection(
+    const Selection& s, const SelectionDelta& delta) const noexcept
+{
+  setSelection(s);
+}
+
 Process::Inlet* ProcessModel::inlet(const Id<Process::Port>& p) const noexcept
 {
   for (auto e : m_inlets)
@@ -92,6 +92,10 @@ public:
   virtual Selection selectableChildren() const noexcept;
   virtual Selection selectedChildren() const noexcept;
   virtual void setSelection(const Selection& s) const noexcept;
+  //! Called instead of setSelection when the selection stays in this
+  //! process: only the objects of the delta need to be updated.
+  virtual void changeSelection(
+      const Selection& s, const SelectionDelta& delta) const noexcept;
 
   double getSlotHeight() const noexcept;
   void setSlotHeight(double) noexcept;
@@ -0,0 +1,160 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include "InternedAddress.hpp"
+
+#include <QDebug>
+#include <QHash>
+
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+namespace State
+{
+namespace
+{
+struct SymbolTable
+{
+  SymbolTable()
+  {
+    // The empty string, i.e. the invisible root device, is always 0
+    atoms.insert(QString{}, 0);
+    strings.push_back(QString{});
+  }
+
+  std::shared_mutex mutex;
+  QHash<QString, AddressAtom> atoms;
+  std::vector<QString> strings;
+};
+
+SymbolTable& symbols()
+{
+  static SymbolTable table;
+  return table;
+}
+
+std::size_t combine(std::size_t seed, AddressAtom atom) noexcept
+{
+  return seed ^ (std::size_t(atom) + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+}
+
+AddressAtom AddressSymbols::intern(const QString& str)
+{
+  auto& table = symbols();
+  {
+    std::shared_lock lock{table.mutex};
+    auto it = table.atoms.constFind(str);
+    if (it != table.atoms.constEnd())
+      return *it;
+  }
+
+  std::unique_lock lock{table.mutex};
+  // Another thread may have added it in-between
+  auto it = table.atoms.constFind(str);
+  if (it != table.atoms.constEnd())
+    return *it;
+
+  const AddressAtom atom = table.strings.size();
+  table.atoms.insert(str, atom);
+  table.strings.push_back(str);
+  return atom;
+}
+
+QString AddressSymbols::string(AddressAtom atom)
+{
+  auto& table = symbols();
+  std::shared_lock lock{table.mutex};
+  if (atom >= 0 && std::size_t(atom) < table.strings.size())
+    return table.strings[atom];
+  return {};
+}
+
+std::size_t AddressSymbols::size()
+{
+  auto& table = symbols();
+  std::shared_lock lock{table.mutex};
+  return table.strings.size();
+}
+
+InternedAddress::InternedAddress() noexcept
+{
+  rehash();
+}
+
+InternedAddress::InternedAddress(const Address& addr)
+    : m_device{AddressSymbols::intern(addr.device)}
+{
+  m_path.reserve(addr.path.size());
+  for (const auto& segment : addr.path)
+    m_path.push_back(AddressSymbols::intern(segment));
+  rehash();
+}
+
+InternedAddress::InternedAddress(
+    AddressAtom device, path_type path) noexcept
+    : m_path{std::move(path)}, m_device{device}
+{
+  rehash();
+}
+
+void InternedAddress::setSegment(int i, AddressAtom atom) noexcept
+{
+  m_path[i] = atom;
+  rehash();
+}
+
+void InternedAddress::append(AddressAtom atom) noexcept
+{
+  m_path.push_back(atom);
+  m_hash = combine(m_hash, atom);
+}
+
+bool InternedAddress::isParentOf(const InternedAddress& other) const
+    noexcept
+{
+  return m_device == other.m_device && m_path.size() <= other.m_path.size()
+         && std::equal(m_path.begin(), m_path.end(), other.m_path.begin());
+}
+
+Address InternedAddress::toAddress() const
+{
+  Address addr;
+  addr.device = AddressSymbols::string(m_device);
+  addr.path.reserve(m_path.size());
+  for (AddressAtom atom : m_path)
+    addr.path.push_back(AddressSymbols::string(atom));
+  return addr;
+}
+
+QString InternedAddress::toString_unsafe() const
+{
+  return toAddress().toString_unsafe();
+}
+
+bool InternedAddress::operator==(const InternedAddress& other) const noexcept
+{
+  return m_hash == other.m_hash && m_device == other.m_device
+         && m_path.size() == other.m_path.size()
+         && std::equal(m_path.begin(), m_path.end(), other.m_path.begin());
+}
+
+bool InternedAddress::operator!=(const InternedAddress& other) const noexcept
+{
+  return !(*this == other);
+}
+
+void InternedAddress::rehash() noexcept
+{
+  // Must give the same result as successive calls to append()
+  m_hash = combine(0, m_device);
+  for (AddressAtom atom : m_path)
+    m_hash = combine(m_hash, atom);
+}
+
+QDebug operator<<(QDebug d, const State::InternedAddress& a)
+{
+  return d << a.toAddress();
+}
+}
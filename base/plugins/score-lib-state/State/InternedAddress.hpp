@@ -0,0 +1,94 @@
+#pragma once
+#include <State/Address.hpp>
+
+#include <ossia/detail/small_vector.hpp>
+
+#include <score_lib_state_export.h>
+
+#include <cstdint>
+
+namespace State
+{
+//! Index of a string in the AddressSymbols table
+using AddressAtom = int32_t;
+
+/**
+ * @brief Global table of the device names and path segments
+ *
+ * A string is given a small integer the first time it is interned, which
+ * stays valid for the whole lifetime of the application.
+ * The table can be used from any thread.
+ */
+struct SCORE_LIB_STATE_EXPORT AddressSymbols
+{
+  static AddressAtom intern(const QString& str);
+  static QString string(AddressAtom atom);
+  static std::size_t size();
+};
+
+/**
+ * @brief An Address where the device and path are interned
+ *
+ * Comparing two of them only compares integers, and the hash is computed
+ * once. This is the key used in the maps which are looked up each time a
+ * value is received from the network.
+ */
+struct SCORE_LIB_STATE_EXPORT InternedAddress
+{
+  using path_type = ossia::small_vector<AddressAtom, 8>;
+
+  InternedAddress() noexcept;
+  explicit InternedAddress(const Address& addr);
+  InternedAddress(AddressAtom device, path_type path) noexcept;
+
+  AddressAtom device() const noexcept
+  {
+    return m_device;
+  }
+  const path_type& path() const noexcept
+  {
+    return m_path;
+  }
+  std::size_t hash() const noexcept
+  {
+    return m_hash;
+  }
+
+  void setSegment(int i, AddressAtom atom) noexcept;
+  void append(AddressAtom atom) noexcept;
+
+  //! True if this address is a prefix of other
+  bool isParentOf(const InternedAddress& other) const noexcept;
+
+  Address toAddress() const;
+  QString toString_unsafe() const;
+
+  bool operator==(const InternedAddress& other) const noexcept;
+  bool operator!=(const InternedAddress& other) const noexcept;
+
+private:
+  void rehash() noexcept;
+
+  path_type m_path;
+  std::size_t m_hash{};
+  AddressAtom m_device{};
+};
+
+SCORE_LIB_STATE_EXPORT
+QDebug operator<<(QDebug d, const State::InternedAddress& a);
+}
+
+namespace std
+{
+template <>
+struct hash<State::InternedAddress>
+{
+  std::size_t operator()(const State::InternedAddress& k) const noexcept
+  {
+    return k.hash();
+  }
+};
+}
+
+Q_DECLARE_METATYPE(State::InternedAddress)
+W_REGISTER_ARGTYPE(State::InternedAddress)
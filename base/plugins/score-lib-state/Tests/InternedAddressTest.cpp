@@ -0,0 +1,139 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <State/InternedAddress.hpp>
+
+#include <score/tools/std/HashMap.hpp>
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+#include <vector>
+
+class InternedAddressTest : public QObject
+{
+  Q_OBJECT
+
+  // 100 devices of 1000 addresses
+  static std::vector<State::Address> makeAddresses()
+  {
+    std::vector<State::Address> vec;
+    vec.reserve(100000);
+    for (int d = 0; d < 100; d++)
+    {
+      const auto dev = QStringLiteral("device%1").arg(d);
+      for (int i = 0; i < 1000; i++)
+      {
+        vec.push_back(State::Address{
+            dev, {QStringLiteral("group%1").arg(i / 100),
+                  QStringLiteral("sub%1").arg((i / 10) % 10),
+                  QStringLiteral("param%1").arg(i % 10)}});
+      }
+    }
+    return vec;
+  }
+
+private Q_SLOTS:
+  void test_roundtrip()
+  {
+    State::Address a{"dev", {"foo", "bar", "baz"}};
+    State::InternedAddress i{a};
+
+    QCOMPARE(i.toAddress(), a);
+    QCOMPARE(i.toString_unsafe(), a.toString_unsafe());
+    QCOMPARE(i.path().size(), std::size_t(3));
+    QCOMPARE(State::AddressSymbols::string(i.device()), QString("dev"));
+
+    State::Address root{"dev", {}};
+    QCOMPARE(State::InternedAddress{root}.toAddress(), root);
+    QCOMPARE(State::InternedAddress{}.toAddress(), State::Address{});
+  }
+
+  void test_equality()
+  {
+    State::InternedAddress a{State::Address{"dev", {"foo", "bar"}}};
+    State::InternedAddress b{State::Address{"dev", {"foo", "bar"}}};
+    State::InternedAddress c{State::Address{"dev", {"bar", "foo"}}};
+    State::InternedAddress d{State::Address{"other", {"foo", "bar"}}};
+
+    QVERIFY(a == b);
+    QCOMPARE(a.hash(), b.hash());
+    QVERIFY(a != c);
+    QVERIFY(a != d);
+
+    // Same atoms as the strings
+    QCOMPARE(a.path()[0], State::AddressSymbols::intern("foo"));
+    QCOMPARE(a.path()[0], c.path()[1]);
+  }
+
+  void test_edit()
+  {
+    State::InternedAddress parent{State::Address{"dev", {"foo"}}};
+    State::InternedAddress child{State::Address{"dev", {"foo", "bar"}}};
+    QVERIFY(parent.isParentOf(child));
+    QVERIFY(parent.isParentOf(parent));
+    QVERIFY(!child.isParentOf(parent));
+
+    // The hash must not depend on how the address was built
+    State::InternedAddress appended = parent;
+    appended.append(State::AddressSymbols::intern("bar"));
+    QVERIFY(appended == child);
+    QCOMPARE(appended.hash(), child.hash());
+
+    child.setSegment(0, State::AddressSymbols::intern("renamed"));
+    QCOMPARE(
+        child.toAddress(), (State::Address{"dev", {"renamed", "bar"}}));
+    QVERIFY(!parent.isParentOf(child));
+  }
+
+  void bench_lookup_address()
+  {
+    const auto addresses = makeAddresses();
+    score::hash_map<State::Address, int> map;
+    for (std::size_t i = 0; i < addresses.size(); i++)
+      map.insert({addresses[i], int(i)});
+
+    int64_t sum = 0;
+    QBENCHMARK
+    {
+      for (const auto& addr : addresses)
+        sum += map.find(addr)->second;
+    }
+    QVERIFY(sum > 0);
+  }
+
+  void bench_lookup_interned()
+  {
+    const auto addresses = makeAddresses();
+    std::vector<State::InternedAddress> keys;
+    keys.reserve(addresses.size());
+    for (const auto& addr : addresses)
+      keys.emplace_back(addr);
+
+    score::hash_map<State::InternedAddress, int> map;
+    for (std::size_t i = 0; i < keys.size(); i++)
+      map.insert({keys[i], int(i)});
+
+    int64_t sum = 0;
+    QBENCHMARK
+    {
+      for (const auto& key : keys)
+        sum += map.find(key)->second;
+    }
+    QVERIFY(sum > 0);
+  }
+
+  void bench_intern()
+  {
+    const auto addresses = makeAddresses();
+    std::size_t sum = 0;
+    QBENCHMARK
+    {
+      for (const auto& addr : addresses)
+        sum += State::InternedAddress{addr}.hash();
+    }
+    QVERIFY(sum != 0);
+  }
+};
+
+QTEST_APPLESS_MAIN(InternedAddressTest)
+#include "InternedAddressTest.moc"
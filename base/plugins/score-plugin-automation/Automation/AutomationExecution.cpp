@@ -93,8 +93,11 @@ Component::Component(
   // so it may not work perfectly.
   con(element, &Automation::ProcessModel::tweenChanged, this,
       [this](const auto&) { this->recompute(); });
-  con(element, &Automation::ProcessModel::curveChanged, this,
-      [this]() { this->recompute(); });
+  con(element, &Automation::ProcessModel::curveChanged, this, [this]() {
+    const auto& moved = process().curve().movedSegments();
+    if (moved.empty() || !this->patch(moved))
+      this->recompute();
+  });
 
   recompute();
 }
@@ -105,39 +108,102 @@ Component::~Component()
 
 void Component::recompute()
 {
+  m_curve.reset();
+  m_ends.clear();
+
   auto dest
       = Execution::makeDestination(*system().execState, process().address());
 
+  std::shared_ptr<ossia::curve_abstract> curve;
   if (dest)
   {
     auto& d = *dest;
     auto addressType = d.address().get_value_type();
 
-    auto curve = process().tween() ? on_curveChanged(addressType, d)
-                                   : on_curveChanged(addressType, {});
-
-    if (curve)
-    {
-      in_exec([proc = std::dynamic_pointer_cast<ossia::nodes::automation>(
-                   OSSIAProcess().node),
-               curve, d_ = d] { proc->set_behavior(curve); });
-      return;
-    }
+    curve = process().tween() ? on_curveChanged(addressType, d)
+                              : on_curveChanged(addressType, {});
   }
   else
   {
-    auto curve = on_curveChanged_impl<float>({});
+    curve = on_curveChanged_impl<float>({});
+  }
 
-    if (curve)
-    {
-      in_exec([proc = std::dynamic_pointer_cast<ossia::nodes::automation>(
-                   OSSIAProcess().node),
-               curve] { proc->set_behavior(curve); });
-      return;
-    }
+  if (curve)
+  {
+    m_curve = curve;
+    const auto& segments = process().curve().sortedSegments();
+    m_start = segments.front()->start();
+    for (const Curve::SegmentModel* seg : segments)
+      m_ends[seg->id()] = seg->end().x();
+
+    in_exec([proc = std::dynamic_pointer_cast<ossia::nodes::automation>(
+                 OSSIAProcess().node),
+             curve] { proc->set_behavior(curve); });
   }
 }
 
+bool Component::patch(const std::vector<Id<Curve::SegmentModel>>& moved)
+{
+  if (auto c = std::dynamic_pointer_cast<ossia::curve<double, float>>(
+          m_curve))
+    return patch_impl(c, moved);
+  else if (auto c = std::dynamic_pointer_cast<ossia::curve<double, int>>(
+               m_curve))
+    return patch_impl(c, moved);
+  return false;
+}
+
+template <typename Y_T>
+bool Component::patch_impl(
+    const std::shared_ptr<ossia::curve<double, Y_T>>& curve,
+    const std::vector<Id<Curve::SegmentModel>>& moved)
+{
+  const double min = process().min();
+  const double max = process().max();
+  auto scale_y = [=](double val) -> Y_T { return val * (max - min) + min; };
+
+  // Each segment is the point at its end in the ossia curve
+  struct moved_point
+  {
+    double previous_x;
+    double x;
+    Y_T y;
+    ossia::curve_segment<Y_T> segment;
+  };
+
+  const auto& segments = process().curve().segments();
+  std::vector<moved_point> points;
+  points.reserve(moved.size());
+  for (const auto& id : moved)
+  {
+    auto seg_it = segments.find(id);
+    auto end_it = m_ends.find(id);
+    if (seg_it == segments.end() || end_it == m_ends.end())
+      return false;
+
+    const Curve::SegmentModel& seg = *seg_it;
+
+    // The start of the first segment is the origin of the ossia curve
+    if (!seg.previous() && seg.start() != m_start)
+      return false;
+
+    points.push_back(
+        {end_it->second, seg.end().x(), scale_y(seg.end().y()),
+         (seg.*Engine::score_to_ossia::CurveTraits<Y_T>::fun)()});
+  }
+
+  for (std::size_t i = 0; i < moved.size(); i++)
+    m_ends[moved[i]] = points[i].x;
+
+  in_exec([curve, points = std::move(points)] {
+    for (const auto& pt : points)
+      curve->remove_point(pt.previous_x);
+    for (const auto& pt : points)
+      curve->add_point(pt.segment, pt.x, pt.y);
+  });
+  return true;
+}
+
 template <typename Y_T>
 std::shared_ptr<ossia::curve_abstract>
 Component::on_curveChanged_impl(const optional<ossia::destination>& d)
@@ -150,7 +216,7 @@ Component::on_curveChanged_impl(const optional<ossia::destination>& d)
   auto scale_x = [](double val) -> double { return val; };
   auto scale_y = [=](double val) -> Y_T { return val * (max - min) + min; };
 
-  auto segt_data = process().curve().sortedSegments();
+  const auto& segt_data = process().curve().sortedSegments();
   if (segt_data.size() != 0)
   {
     return Engine::score_to_ossia::curve<double, Y_T>(
@@ -1,8 +1,12 @@
 #pragma once
 #include <Automation/AutomationModel.hpp>
+#include <Curve/Palette/CurvePoint.hpp>
 #include <Process/Execution/ProcessComponent.hpp>
 
+#include <score/tools/std/HashMap.hpp>
+
 #include <ossia/dataflow/node_process.hpp>
+#include <ossia/editor/curve/curve.hpp>
 #include <ossia/network/value/destination.hpp>
 #include <ossia/network/value/value.hpp>
 
@@ -11,6 +15,10 @@ namespace ossia
 {
 class curve_abstract;
 }
+namespace Curve
+{
+class SegmentModel;
+}
 
 namespace Automation
 {
@@ -30,12 +38,25 @@ public:
 private:
   void recompute();
 
+  // Moves the points of the running curve instead of recreating it.
+  // Returns false if this is not possible.
+  bool patch(const std::vector<Id<Curve::SegmentModel>>& moved);
+  template <typename Y_T>
+  bool patch_impl(
+      const std::shared_ptr<ossia::curve<double, Y_T>>& curve,
+      const std::vector<Id<Curve::SegmentModel>>& moved);
+
   std::shared_ptr<ossia::curve_abstract>
   on_curveChanged(ossia::val_type, const optional<ossia::destination>&);
 
   template <typename T>
   std::shared_ptr<ossia::curve_abstract>
   on_curveChanged_impl(const optional<ossia::destination>&);
+
+  // The curve given to the engine, and the position of the points in it
+  std::shared_ptr<ossia::curve_abstract> m_curve;
+  score::hash_map<Id<Curve::SegmentModel>, double> m_ends;
+  Curve::Point m_start;
 };
 using ComponentFactory = ::Execution::ProcessComponentFactory_T<Component>;
 }
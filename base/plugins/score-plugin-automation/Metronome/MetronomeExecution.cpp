@@ -42,7 +42,7 @@ std::shared_ptr<ossia::curve<double, float>> Component::on_curveChanged()
   auto scale_x = [](double val) -> double { return val; };
   auto scale_y = [=](double val) -> float { return val * (max - min) + min; };
 
-  auto segt_data = process().curve().sortedSegments();
+  const auto& segt_data = process().curve().sortedSegments();
   if (segt_data.size() != 0)
   {
     return Engine::score_to_ossia::curve<double, float>(
@@ -24,13 +24,13 @@ UpdateCurve::UpdateCurve(
 void UpdateCurve::undo(const score::DocumentContext& ctx) const
 {
   auto& curve = m_model.find(ctx);
-  curve.fromCurveData(m_oldCurveData);
+  curve.updateCurveData(m_oldCurveData);
 }
 
 void UpdateCurve::redo(const score::DocumentContext& ctx) const
 {
   auto& curve = m_model.find(ctx);
-  curve.fromCurveData(m_newCurveData);
+  curve.updateCurveData(m_newCurveData);
 }
 
 void UpdateCurve::serializeImpl(DataStreamInput& s) const
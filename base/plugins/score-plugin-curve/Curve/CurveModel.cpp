@@ -32,6 +32,7 @@
 #include <wobjectimpl.h>
 
 #include <algorithm>
+#include <utility>
 W_OBJECT_IMPL(Curve::Model)
 
 namespace Curve
@@ -175,10 +176,12 @@ void Model::insertSegment(SegmentModel* m)
 {
   m->setParent(this);
   m_segments.insert(m);
+  m_sortedValid = false;
 
   // TODO have indexes on the points with the start and end
   // curve segments
   connect(m, &SegmentModel::startChanged, this, [=]() {
+    m_sortedValid = false;
     for (PointModel* pt : m_points)
     {
       if (pt->following() == m->id())
@@ -205,6 +208,7 @@ void Model::insertSegment(SegmentModel* m)
 void Model::removeSegment(SegmentModel* m)
 {
   m_segments.remove(m->id());
+  m_sortedValid = false;
 
   segmentRemoved(m->id());
 
@@ -229,19 +233,25 @@ void Model::removeSegment(SegmentModel* m)
   delete m;
 }
 
-std::vector<SegmentModel*> Model::sortedSegments() const
+const std::vector<SegmentModel*>& Model::sortedSegments() const
 {
-  std::vector<SegmentModel*> dat;
-  dat.reserve(m_segments.size());
-  for (auto& seg : m_segments)
+  if (!m_sortedValid)
   {
-    dat.push_back(&seg);
-  }
+    auto& dat = m_sortedSegments;
+    dat.clear();
+    dat.reserve(m_segments.size());
+    for (auto& seg : m_segments)
+    {
+      dat.push_back(&seg);
+    }
 
-  ossia::sort(
-      dat, [](auto s1, auto s2) { return s1->start().x() < s2->start().x(); });
+    ossia::sort(dat, [](auto s1, auto s2) {
+      return s1->start().x() < s2->start().x();
+    });
+    m_sortedValid = true;
+  }
 
-  return dat;
+  return m_sortedSegments;
 }
 
 std::vector<SegmentData> Model::toCurveData() const
@@ -282,6 +292,56 @@ void Model::fromCurveData(const std::vector<SegmentData>& curve)
   changed();
 }
 
+void Model::updateCurveData(const std::vector<SegmentData>& curve)
+{
+  if (curve.size() != m_segments.size())
+  {
+    fromCurveData(curve);
+    return;
+  }
+
+  // Look for the segments which only moved: anything else
+  // (new segments, new links, new types...) requires a reset.
+  std::vector<std::pair<SegmentModel*, const SegmentData*>> moved;
+  for (const SegmentData& data : curve)
+  {
+    auto it = m_segments.find(data.id);
+    if (it == m_segments.end())
+    {
+      fromCurveData(curve);
+      return;
+    }
+
+    SegmentModel& seg = *it;
+    if (seg.previous() != data.previous || seg.following() != data.following
+        || seg.concreteKey() != data.type
+        || seg.toSegmentData().specificSegmentData
+               != data.specificSegmentData)
+    {
+      fromCurveData(curve);
+      return;
+    }
+
+    if (seg.start() != data.start || seg.end() != data.end)
+      moved.push_back({&seg, &data});
+  }
+
+  if (moved.empty())
+    return;
+
+  m_movedSegments.reserve(moved.size());
+  for (const auto& [seg, data] : moved)
+  {
+    seg->setStart(data->start);
+    seg->setEnd(data->end);
+    m_movedSegments.push_back(seg->id());
+    segmentMoved(*seg);
+  }
+
+  changed();
+  m_movedSegments.clear();
+}
+
 Selection Model::selectedChildren() const
 {
   Selection s;
@@ -301,11 +361,10 @@ Selection Model::selectedChildren() const
 
 void Model::setSelection(const Selection& s)
 {
-  // OPTIMIZEME
   for (auto& elt : m_segments)
-    elt.selection.set(s.contains(&elt));
+    elt.selection.update(s.contains(&elt));
   for (auto& elt : m_points)
-    elt->selection.set(s.contains(elt));
+    elt->selection.update(s.contains(elt));
 }
 
 void Model::clear()
@@ -314,6 +373,7 @@ void Model::clear()
 
   auto segs = shallow_copy(m_segments);
   m_segments.clear();
+  m_sortedValid = false;
   for (auto seg : segs)
     seg->deleteLater();
 
@@ -50,10 +50,22 @@ public:
   // Here we don't pass an id because it's more efficient
   void removeSegment(SegmentModel* m);
 
-  std::vector<SegmentModel*> sortedSegments() const;
+  //! Segments sorted by their start; cached until a segment moves.
+  const std::vector<SegmentModel*>& sortedSegments() const;
   std::vector<SegmentData> toCurveData() const;
   void fromCurveData(const std::vector<SegmentData>& curve);
 
+  //! Like fromCurveData, but if only the start and end of the existing
+  //! segments differ, they are updated in place instead of recreated.
+  void updateCurveData(const std::vector<SegmentData>& curve);
+
+  //! The segments moved by the update being notified through changed().
+  //! Empty if the whole curve has to be considered as changed.
+  const std::vector<Id<SegmentModel>>& movedSegments() const
+  {
+    return m_movedSegments;
+  }
+
   Selection selectedChildren() const;
   void setSelection(const Selection& s);
 
@@ -85,6 +97,8 @@ public:
       E_SIGNAL(SCORE_PLUGIN_CURVE_EXPORT, pointAdded, arg_1);
   void pointRemoved(const Id<PointModel>& arg_1) E_SIGNAL(
       SCORE_PLUGIN_CURVE_EXPORT, pointRemoved, arg_1); // dangerous if async
+  void segmentMoved(const SegmentModel& arg_1)
+      E_SIGNAL(SCORE_PLUGIN_CURVE_EXPORT, segmentMoved, arg_1);
 
   // This signal has to be emitted after big modifications.
   // (it's an optimization to prevent updating the OSSIA API each time a
@@ -101,6 +115,10 @@ private:
 
   IdContainer<SegmentModel> m_segments;
   std::vector<PointModel*> m_points; // Each between 0, 1
+
+  std::vector<Id<SegmentModel>> m_movedSegments;
+  mutable std::vector<SegmentModel*> m_sortedSegments;
+  mutable bool m_sortedValid{};
 };
 
 SCORE_PLUGIN_CURVE_EXPORT
@@ -133,6 +133,13 @@ void Presenter::setupSignals()
   con(m_model, &Model::segmentRemoved, this,
       [&](const Id<SegmentModel>& m) { m_segments.erase(m); });
 
+  // Only the views of the moved segments are updated
+  con(m_model, &Model::segmentMoved, this, [&](const SegmentModel& m) {
+    auto it = m_segments.find(m.id());
+    if (it != m_segments.end())
+      setPos(*it);
+  });
+
   con(m_model, &Model::cleared, this, [&]() {
     m_points.remove_all();
     m_segments.remove_all();
@@ -13,6 +13,8 @@
 #include <score/model/tree/TreeNode.hpp>
 #include <score/serialization/DataStreamVisitor.hpp>
 
+#include <ossia/detail/algorithms.hpp>
+
 #include <QAbstractItemModel>
 #include <QString>
 
@@ -23,9 +25,23 @@ namespace Explorer
 {
 namespace Command
 {
-// TODO fix this to use NodeUpdateProxy. Maybe it should be a Remove() followed
-// by
-// a LoadDevice() ?
+static void replaceDevice(
+    DeviceExplorerModel& explorer, const Device::Node& device,
+    const Device::NodeDiff& diff)
+{
+  const auto& name = device.get<Device::DeviceSettings>().name;
+  auto& root = explorer.rootNode();
+  auto it = ossia::find_if(root, [&](const Device::Node& n) {
+    return n.is<Device::DeviceSettings>()
+           && n.get<Device::DeviceSettings>().name == name;
+  });
+
+  if (it != root.end())
+    explorer.applyDiff(*it, diff);
+  else
+    explorer.addDevice(device);
+}
+
 ReplaceDevice::ReplaceDevice(
     const DeviceDocumentPlugin& device_tree, int deviceIndex,
     Device::Node&& rootNode)
@@ -45,30 +61,39 @@ ReplaceDevice::ReplaceDevice(
 {
 }
 
+ReplaceDevice::ReplaceDevice(
+    const DeviceDocumentPlugin& device_tree, int deviceIndex,
+    Device::Node&& oldRootNode, Device::Node&& newRootNode,
+    Device::NodeDiff&& diff)
+    : m_deviceIndex(deviceIndex)
+    , m_deviceNode{std::move(newRootNode)}
+    , m_savedNode{std::move(oldRootNode)}
+    , m_diff{std::move(diff)}
+{
+}
+
 void ReplaceDevice::undo(const score::DocumentContext& ctx) const
 {
   auto& explorer = ctx.plugin<DeviceDocumentPlugin>().explorer();
-
-  explorer.removeRow(m_deviceIndex);
-  explorer.addDevice(m_savedNode);
+  replaceDevice(
+      explorer, m_savedNode, Device::diff(m_deviceNode, m_savedNode));
 }
 
 void ReplaceDevice::redo(const score::DocumentContext& ctx) const
 {
   auto& explorer = ctx.plugin<DeviceDocumentPlugin>().explorer();
 
-  const auto& cld = explorer.rootNode().children();
-  for (auto it = cld.begin(); it != cld.end(); ++it)
+  // The diff given at construction is only kept until the first redo.
+  if (m_diff)
   {
-    auto ds = it->get<Device::DeviceSettings>();
-    if (ds.name == m_deviceNode.get<Device::DeviceSettings>().name)
-    {
-      explorer.removeNode(it);
-      break;
-    }
+    replaceDevice(explorer, m_deviceNode, *m_diff);
+    m_diff = ossia::none;
+  }
+  else
+  {
+    replaceDevice(
+        explorer, m_deviceNode, Device::diff(m_savedNode, m_deviceNode));
   }
-
-  explorer.addDevice(m_deviceNode);
 }
 
 void ReplaceDevice::serializeImpl(DataStreamInput& d) const
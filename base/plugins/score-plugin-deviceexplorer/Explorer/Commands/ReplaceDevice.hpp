@@ -1,5 +1,6 @@
 #pragma once
 #include <Device/Node/DeviceNode.hpp>
+#include <Device/Node/NodeDiff.hpp>
 #include <Explorer/Commands/DeviceExplorerCommandFactory.hpp>
 
 #include <score/command/Command.hpp>
@@ -14,6 +15,8 @@ class DeviceDocumentPlugin;
 namespace Command
 {
 // Replaces all the nodes of a device by new nodes.
+// The device explorer is updated in place with the difference between
+// the two versions, so that the nodes which did not change are kept.
 class ReplaceDevice final : public score::Command
 {
   SCORE_COMMAND_DECL(
@@ -25,6 +28,12 @@ public:
   ReplaceDevice(
       const DeviceDocumentPlugin& device_tree, int deviceIndex,
       Device::Node&& oldDevice, Device::Node&& newDevice);
+  // diff must be the difference from oldDevice to newDevice; it
+  // is used for the first redo instead of being computed again.
+  ReplaceDevice(
+      const DeviceDocumentPlugin& device_tree, int deviceIndex,
+      Device::Node&& oldDevice, Device::Node&& newDevice,
+      Device::NodeDiff&& diff);
 
   void undo(const score::DocumentContext& ctx) const override;
   void redo(const score::DocumentContext& ctx) const override;
@@ -37,6 +46,7 @@ private:
   int m_deviceIndex{};
   Device::Node m_deviceNode;
   Device::Node m_savedNode;
+  mutable optional<Device::NodeDiff> m_diff;
 };
 }
 }
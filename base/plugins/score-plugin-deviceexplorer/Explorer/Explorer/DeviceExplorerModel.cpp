@@ -6,6 +6,7 @@
 #include <Device/ItemModels/NodeBasedItemModel.hpp>
 #include <Device/ItemModels/NodeDisplayMethods.hpp>
 #include <Device/Node/DeviceNode.hpp>
+#include <Device/Node/NodeDiff.hpp>
 #include <Device/Node/NodeListMimeSerialization.hpp>
 #include <Device/Protocol/DeviceSettings.hpp>
 #include <Device/Protocol/ProtocolFactoryInterface.hpp>
@@ -216,6 +217,91 @@ void DeviceExplorerModel::updateAddress(
       modelIndexFromNode(*node, (int)Column::Count - 1));
 }
 
+void DeviceExplorerModel::applyDiff(
+    Device::Node& node, const Device::NodeDiff& diff)
+{
+  SCORE_ASSERT(
+      node.is<Device::AddressSettings>() || node.is<Device::DeviceSettings>());
+  if (diff.settings && node.is<Device::AddressSettings>())
+    updateAddress(&node, *diff.settings);
+
+  const QModelIndex parentIndex = modelIndexFromNode(node, 0);
+
+  if (!diff.removed.empty())
+  {
+    // Group the rows to remove in contiguous ranges
+    struct range
+    {
+      int first{};
+      int last{};
+      Device::Node::const_iterator begin;
+      Device::Node::const_iterator end;
+    };
+    std::vector<range> ranges;
+
+    auto child = node.cbegin();
+    int row = 0;
+    for (int removed : diff.removed)
+    {
+      if (removed >= node.childCount())
+        break;
+
+      std::advance(child, removed - row);
+      row = removed;
+      if (!ranges.empty() && ranges.back().last == row - 1)
+      {
+        ranges.back().last = row;
+        ranges.back().end = std::next(child);
+      }
+      else
+      {
+        ranges.push_back({row, row, child, std::next(child)});
+      }
+    }
+
+    // Starting from the end so that the rows of the next ranges stay valid
+    for (auto it = ranges.rbegin(); it != ranges.rend(); ++it)
+    {
+      beginRemoveRows(parentIndex, it->first, it->last);
+      node.erase(it->begin, it->end);
+      endRemoveRows();
+    }
+  }
+
+  if (!diff.added.empty())
+  {
+    const auto& added = diff.added;
+    auto pos = node.begin();
+    int pos_row = 0;
+
+    std::size_t i = 0;
+    while (i < added.size())
+    {
+      std::size_t j = i + 1;
+      while (j < added.size() && added[j].first == added[j - 1].first + 1)
+        j++;
+
+      const int first = std::min(added[i].first, node.childCount());
+      std::advance(pos, first - pos_row);
+      pos_row = first;
+
+      beginInsertRows(parentIndex, first, first + int(j - i) - 1);
+      for (; i < j; i++)
+      {
+        node.emplace(pos, added[i].second, &node);
+        pos_row++;
+      }
+      endInsertRows();
+    }
+  }
+
+  for (const auto& sub : diff.children)
+  {
+    if (sub.row >= 0 && sub.row < node.childCount())
+      applyDiff(node.childAt(sub.row), sub);
+  }
+}
+
 void DeviceExplorerModel::updateValue(
     Device::Node* n, const State::AddressAccessor& addr, const ossia::value& v)
 {
@@ -26,6 +26,7 @@ namespace Device
 {
 struct DeviceSettings;
 struct AddressSettings;
+struct NodeDiff;
 }
 
 namespace Explorer
@@ -112,6 +113,10 @@ public:
 
   void addNode(Device::Node* parentNode, Device::Node&& child, int row);
 
+  // Updates a node in place: contiguous inserted or removed rows are
+  // notified as a single batch, and untouched nodes keep their indexes.
+  void applyDiff(Device::Node& node, const Device::NodeDiff& diff);
+
   void updateValue(
       Device::Node* n, const State::AddressAccessor& addr,
       const ossia::value& v);
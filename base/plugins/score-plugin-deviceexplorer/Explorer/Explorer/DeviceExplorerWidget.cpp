@@ -413,7 +413,12 @@ void DeviceExplorerWidget::buildGUI()
   m_refreshIndicator = new QProgressIndicator{refreshParent};
   m_refreshIndicator->setStyleSheet("background:transparent");
   m_refreshIndicator->setAttribute(Qt::WA_TranslucentBackground);
-  refreshLay->addWidget(m_refreshIndicator);
+  refreshLay->addWidget(m_refreshIndicator, 0, 0, Qt::AlignCenter);
+  auto cancelRefresh = new QPushButton{tr("Cancel"), refreshParent};
+  connect(
+      cancelRefresh, &QPushButton::clicked, this,
+      &DeviceExplorerWidget::refreshCanceled);
+  refreshLay->addWidget(cancelRefresh, 1, 0, Qt::AlignCenter);
   m_lay->addWidget(refreshParent);
   setLayout(m_lay);
 }
@@ -776,14 +781,15 @@ void DeviceExplorerWidget::refresh()
     if (!dev.connected())
       return;
     auto wrkr = make_worker(
-        [=](Device::Node&& node) {
+        [=](Device::Node&& old, Device::Node&& node,
+            Device::NodeDiff&& diff) {
           auto cmd = new Explorer::Command::ReplaceDevice{
               m->deviceModel(), m_ntView->selectedIndex().row(),
-              std::move(node)};
+              std::move(old), std::move(node), std::move(diff)};
 
           m_cmdDispatcher->submit(cmd);
         },
-        *this, dev);
+        *this, dev, select);
 
     wrkr->start();
   }
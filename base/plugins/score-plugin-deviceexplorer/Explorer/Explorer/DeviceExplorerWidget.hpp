@@ -132,5 +132,7 @@ private:
 public:
   void findAddresses(QStringList strlst)
       E_SIGNAL(SCORE_PLUGIN_DEVICEEXPLORER_EXPORT, findAddresses, strlst);
+  void refreshCanceled()
+      E_SIGNAL(SCORE_PLUGIN_DEVICEEXPLORER_EXPORT, refreshCanceled);
 };
 }
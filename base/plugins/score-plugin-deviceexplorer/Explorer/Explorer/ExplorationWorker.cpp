@@ -6,8 +6,9 @@
 W_OBJECT_IMPL(Explorer::ExplorationWorker)
 namespace Explorer
 {
-ExplorationWorker::ExplorationWorker(Device::DeviceInterface& theDev)
-    : dev{theDev}
+ExplorationWorker::ExplorationWorker(
+    Device::DeviceInterface& theDev, Device::Node cur)
+    : dev{theDev}, current{std::move(cur)}
 {
 }
 }
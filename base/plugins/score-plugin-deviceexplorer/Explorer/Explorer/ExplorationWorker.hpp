@@ -1,11 +1,14 @@
 #pragma once
 #include <Device/Node/DeviceNode.hpp>
+#include <Device/Node/NodeDiff.hpp>
 
 #include <QObject>
 #include <QString>
 
 #include <wobjectdefs.h>
 
+#include <atomic>
+
 namespace Device
 {
 class DeviceInterface;
@@ -18,15 +21,21 @@ namespace Explorer
  *
  * Used as a thread worker to perform refreshing of a remote device without GUI
  * interruption. See DeviceExplorerWidget::refresh() for usage.
+ *
+ * The difference with the current state of the device is also computed
+ * in the thread, so that the GUI only has to apply it.
  */
 class ExplorationWorker final : public QObject
 {
   W_OBJECT(ExplorationWorker)
 public:
   Device::DeviceInterface& dev;
-  Device::Node node; // Result
+  Device::Node current;  // Input
+  Device::Node node;     // Result
+  Device::NodeDiff diff; // Result
+  std::atomic_bool canceled{false};
 
-  explicit ExplorationWorker(Device::DeviceInterface& dev);
+  ExplorationWorker(Device::DeviceInterface& dev, Device::Node current);
 
 public:
   void finished() W_SIGNAL(finished);
@@ -2,6 +2,7 @@
 #include "ExplorationWorker.hpp"
 
 #include <Device/Protocol/DeviceInterface.hpp>
+#include <Explorer/Explorer/DeviceExplorerWidget.hpp>
 
 #include <QApplication>
 #include <QMessageBox>
@@ -9,10 +10,11 @@
 
 namespace Explorer
 {
-class DeviceExplorerWidget;
-
 /**
  * Utility class to get a node from the DeviceExplorerWidget.
+ *
+ * The refresh can be canceled from the widget: the GUI is then
+ * unblocked at once and the result is discarded when the thread finishes.
  */
 template <typename OnSuccess>
 class ExplorationWorkerWrapper final : public QObject
@@ -22,13 +24,14 @@ class ExplorationWorkerWrapper final : public QObject
   DeviceExplorerWidget& m_widget;
 
   OnSuccess m_success;
+  bool m_canceled{false};
 
 public:
   template <typename OnSuccess_t>
   ExplorationWorkerWrapper(
       OnSuccess_t&& success, DeviceExplorerWidget& widg,
-      Device::DeviceInterface& dev)
-      : worker{new ExplorationWorker{dev}}
+      Device::DeviceInterface& dev, Device::Node current)
+      : worker{new ExplorationWorker{dev, std::move(current)}}
       , m_widget{widg}
       , m_success{std::move(success)}
   {
@@ -44,6 +47,10 @@ public:
     QObject::connect(
         worker, &ExplorationWorker::failed, this,
         &ExplorationWorkerWrapper::on_fail, Qt::QueuedConnection);
+
+    QObject::connect(
+        &m_widget, &DeviceExplorerWidget::refreshCanceled, this,
+        &ExplorationWorkerWrapper::on_cancel);
   }
 
   void start()
@@ -59,6 +66,11 @@ private:
     try
     {
       worker->node = worker->dev.refresh();
+      if (!worker->canceled)
+      {
+        worker->diff = Device::diff(
+            worker->current, worker->node, &worker->canceled);
+      }
       worker->finished();
     }
     catch (std::runtime_error& e)
@@ -67,23 +79,43 @@ private:
     }
   }
 
-  void on_finish()
+  void on_cancel()
   {
+    if (m_canceled)
+      return;
+
+    // The device call cannot be interrupted: we just stop waiting for it.
+    m_canceled = true;
+    worker->canceled = true;
     m_widget.blockGUI(false);
-    m_success(std::move(worker->node));
+  }
+
+  void on_finish()
+  {
+    if (!m_canceled)
+    {
+      m_widget.blockGUI(false);
+      m_success(
+          std::move(worker->current), std::move(worker->node),
+          std::move(worker->diff));
+    }
 
     cleanup();
   }
 
   void on_fail(const QString& str)
   {
-    QMessageBox::warning(
-        QApplication::activeWindow(),
-        QObject::tr("Unable to refresh the device"),
-        QObject::tr("Unable to refresh the device: ")
-            + worker->dev.settings().name + QObject::tr(".\nCause: ") + str);
-
-    m_widget.blockGUI(false);
+    if (!m_canceled)
+    {
+      QMessageBox::warning(
+          QApplication::activeWindow(),
+          QObject::tr("Unable to refresh the device"),
+          QObject::tr("Unable to refresh the device: ")
+              + worker->dev.settings().name + QObject::tr(".\nCause: ")
+              + str);
+
+      m_widget.blockGUI(false);
+    }
     cleanup();
   }
 
@@ -98,9 +130,9 @@ private:
 template <typename OnSuccess_t>
 static auto make_worker(
     OnSuccess_t&& success, DeviceExplorerWidget& widg,
-    Device::DeviceInterface& dev)
+    Device::DeviceInterface& dev, Device::Node current)
 {
   return new ExplorationWorkerWrapper<OnSuccess_t>{std::move(success), widg,
-                                                   dev};
+                                                   dev, std::move(current)};
 }
 }
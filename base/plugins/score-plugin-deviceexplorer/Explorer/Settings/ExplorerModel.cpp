@@ -12,13 +12,15 @@ namespace Parameters
 {
 SETTINGS_PARAMETER_IMPL(LocalTree){QStringLiteral("score_plugin_LocalTree"),
                                    true};
+SETTINGS_PARAMETER_IMPL(LazyLocalTree){
+    QStringLiteral("score_plugin_engine/LazyLocalTree"), false};
 SETTINGS_PARAMETER_IMPL(LogLevel){
     QStringLiteral("score_plugin_engine/LogLevel"),
     DeviceLogLevel{}.logEverything};
 
 static auto list()
 {
-  return std::tie(LocalTree, LogLevel);
+  return std::tie(LocalTree, LazyLocalTree, LogLevel);
 }
 }
 
@@ -28,6 +30,7 @@ Model::Model(QSettings& set, const score::ApplicationContext& ctx)
 }
 
 SCORE_SETTINGS_PARAMETER_CPP(bool, Model, LocalTree)
+SCORE_SETTINGS_PARAMETER_CPP(bool, Model, LazyLocalTree)
 SCORE_SETTINGS_PARAMETER_CPP(QString, Model, LogLevel)
 }
 
@@ -23,6 +23,7 @@ class SCORE_PLUGIN_DEVICEEXPLORER_EXPORT Model
   W_OBJECT(Model)
 
   bool m_LocalTree = false;
+  bool m_LazyLocalTree = false;
   QString m_LogLevel;
 
 public:
@@ -30,11 +31,14 @@ public:
 
   SCORE_SETTINGS_PARAMETER_HPP(
       SCORE_PLUGIN_DEVICEEXPLORER_EXPORT, bool, LocalTree)
+  SCORE_SETTINGS_PARAMETER_HPP(
+      SCORE_PLUGIN_DEVICEEXPLORER_EXPORT, bool, LazyLocalTree)
   SCORE_SETTINGS_PARAMETER_HPP(
       SCORE_PLUGIN_DEVICEEXPLORER_EXPORT, QString, LogLevel)
 };
 
 SCORE_SETTINGS_PARAMETER(Model, LogLevel)
+SCORE_SETTINGS_PARAMETER(Model, LazyLocalTree)
 SCORE_SETTINGS_DEFERRED_PARAMETER(Model, LocalTree)
 }
 
@@ -21,6 +21,9 @@ View::View() : m_widg{new QWidget}
   lay->addRow(tr("Enable local tree"), m_cb);
 
   connect(m_cb, &QCheckBox::stateChanged, this, &View::localTreeChanged);
+
+  SETTINGS_UI_TOGGLE_SETUP(
+      "Only expose remote-controllable elements", LazyLocalTree);
 }
 
 void View::setLocalTree(bool val)
@@ -35,6 +38,7 @@ QWidget* View::getWidget()
 }
 
 SETTINGS_UI_COMBOBOX_IMPL(LogLevel)
+SETTINGS_UI_TOGGLE_IMPL(LazyLocalTree)
 }
 
 namespace Explorer::ProjectSettings
@@ -18,6 +18,7 @@ public:
   void localTreeChanged(bool arg_1) W_SIGNAL(localTreeChanged, arg_1);
 
   SETTINGS_UI_COMBOBOX_HPP(LogLevel)
+  SETTINGS_UI_TOGGLE_HPP(LazyLocalTree)
 
 private:
   QWidget* getWidget() override;
@@ -0,0 +1,96 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <Device/Node/DeviceNode.hpp>
+#include <Device/Node/NodeDiff.hpp>
+
+#include <QObject>
+#include <QString>
+#include <QtTest/QtTest>
+
+#include <atomic>
+#include <iterator>
+
+class NodeDiffTest : public QObject
+{
+  Q_OBJECT
+
+private Q_SLOTS:
+  void test_diff()
+  {
+    auto address = [](QString name, int val) {
+      Device::AddressSettings s;
+      s.name = std::move(name);
+      s.value = val;
+      return s;
+    };
+
+    Device::Node before(
+        Device::DeviceSettings{UuidKey<Device::ProtocolFactory>{
+                                   "85783b8d-454d-4326-a070-9666d2534eff"},
+                               "ADevice",
+                               {}},
+        nullptr);
+    auto& a = before.emplace_back(address("a", 0), nullptr);
+    a.emplace_back(address("x", 0), nullptr);
+    a.emplace_back(address("y", 0), nullptr);
+    before.emplace_back(address("b", 0), nullptr);
+    before.emplace_back(address("c", 0), nullptr);
+
+    // Identical trees
+    QVERIFY(Device::diff(before, before).empty());
+
+    Device::Node after = before;
+    // Remove b, add d after c, change the value of a/y, add a/z
+    after.erase(std::next(after.begin()));
+    after.emplace_back(address("d", 0), nullptr);
+    auto& a2 = after.childAt(0);
+    a2.childAt(1).set(address("y", 1));
+    a2.emplace_back(address("z", 0), nullptr);
+
+    auto d = Device::diff(before, after);
+    QVERIFY(!d.settings);
+    QCOMPARE(d.removed.size(), std::size_t(1));
+    QCOMPARE(d.removed[0], 1);
+    QCOMPARE(d.added.size(), std::size_t(1));
+    QCOMPARE(d.added[0].first, 2);
+    QCOMPARE(d.added[0].second.displayName(), QString("d"));
+
+    QCOMPARE(d.children.size(), std::size_t(1));
+    const auto& da = d.children[0];
+    QCOMPARE(da.name, QString("a"));
+    QCOMPARE(da.row, 0);
+    QVERIFY(!da.settings);
+    QVERIFY(da.removed.empty());
+    QCOMPARE(da.added.size(), std::size_t(1));
+    QCOMPARE(da.added[0].first, 2);
+    QCOMPARE(da.children.size(), std::size_t(1));
+    QCOMPARE(da.children[0].name, QString("y"));
+    QCOMPARE(da.children[0].row, 1);
+    QVERIFY(bool(da.children[0].settings));
+    QVERIFY(da.children[0].settings->value == ossia::value(1));
+
+    // A node which moves before another one is removed and added again
+    Device::Node moved = before;
+    moved.emplace(moved.begin(), address("c", 0), nullptr);
+    moved.erase(std::prev(moved.end()));
+    auto dm = Device::diff(before, moved);
+    QCOMPARE(dm.removed.size(), std::size_t(1));
+    QCOMPARE(dm.removed[0], 2);
+    QCOMPARE(dm.added.size(), std::size_t(1));
+    QCOMPARE(dm.added[0].first, 0);
+
+    // With duplicate names only the removed sibling is in the diff
+    Device::Node dup = before;
+    dup.emplace_back(address("b", 1), nullptr);
+    auto dd = Device::diff(dup, before);
+    QCOMPARE(dd.removed.size(), std::size_t(1));
+    QCOMPARE(dd.removed[0], 3);
+
+    // Cancellation stops the computation
+    std::atomic_bool canceled{true};
+    QVERIFY(Device::diff(before, after, &canceled).empty());
+  }
+};
+
+QTEST_APPLESS_MAIN(NodeDiffTest)
+#include "NodeDiffTest.moc"
@@ -46,6 +46,7 @@
 #include <QApplication>
 #include <QLabel>
 #include <QMessageBox>
+#include <QPointer>
 #include <QVariant>
 #include <QVector>
 
@@ -244,6 +245,21 @@ score::GUIElements ApplicationPlugin::makeGUIElements()
         time_label->setText("00:00:00.000");
       }
     });
+
+    auto cpu_label = new QLabel;
+    cpu_label->setToolTip(tr("Load of the audio thread for this document"));
+    bar->addWidget(cpu_label);
+    connect(timer, &QTimer::timeout, this, [=] {
+      Execution::DocumentPlugin* plug{};
+      if (auto doc = currentDocument())
+        plug = doc->context().findPlugin<Execution::DocumentPlugin>();
+
+      if (plug && plug->isPlaying())
+        cpu_label->setText(
+            tr("CPU: %1%").arg(int(100.f * plug->cpuLoad.load())));
+      else
+        cpu_label->setText({});
+    });
     timer->start(1000 / 20);
     toolbars.emplace_back(
         bar, StringKey<score::Toolbar>("Timing"), Qt::BottomToolBarArea, 100);
@@ -273,9 +289,13 @@ score::GUIElements ApplicationPlugin::makeGUIElements()
     sl->setValue(0.5);
     bar->addWidget(sl);
     connect(sl, &Control::VolumeSlider::valueChanged, this, [=](double v) {
-      if (m_clock)
+      // Each playing document has its own gain
+      auto doc = currentDocument();
+      if (!doc)
+        return;
+      if (auto plug = doc->context().findPlugin<Execution::DocumentPlugin>())
       {
-        if (auto& st = m_clock->context.execState)
+        if (auto& st = plug->execState)
         {
           for (auto& dev : st->edit_devices())
           {
@@ -507,6 +527,12 @@ void ApplicationPlugin::on_play(
 
   if (b)
   {
+    if (m_playing && m_clock && &m_clock->context.doc.document != doc)
+    {
+      playGuest(*doc, cst, std::move(setup_fun), t);
+      return;
+    }
+
     if (m_playing)
     {
       SCORE_ASSERT(bool(m_clock));
@@ -551,7 +577,15 @@ void ApplicationPlugin::on_play(
   }
   else
   {
-    if (m_clock)
+    auto guest = std::find_if(m_guests.begin(), m_guests.end(), [&](auto& g) {
+      return g.document == doc;
+    });
+    if (guest != m_guests.end())
+    {
+      guest->clock->pause();
+      doc->context().execTimer.stop();
+    }
+    else if (m_clock)
     {
       m_clock->pause();
       m_paused = true;
@@ -561,6 +595,51 @@ void ApplicationPlugin::on_play(
   }
 }
 
+void ApplicationPlugin::playGuest(
+    score::Document& doc, Scenario::IntervalModel& cst,
+    exec_setup_fun setup_fun, TimeVal t)
+{
+  auto guest = std::find_if(m_guests.begin(), m_guests.end(), [&](auto& g) {
+    return g.document == &doc;
+  });
+  if (guest != m_guests.end())
+  {
+    if (guest->clock->paused())
+    {
+      guest->clock->resume();
+      doc.context().execTimer.start();
+    }
+    return;
+  }
+
+  auto plugmodel = doc.context().findPlugin<Execution::DocumentPlugin>();
+  auto explorer = Explorer::try_deviceExplorerFromObject(doc);
+  if (explorer
+      && !doc.context()
+              .app.settings<Execution::Settings::Model>()
+              .getExecutionListening())
+  {
+    explorer->deviceModel().listening().stop();
+  }
+
+  // The audio engine is left to the document which is already playing
+  plugmodel->reload(cst);
+
+  auto& c = plugmodel->context();
+  auto clock = makeClock(c);
+
+  if (setup_fun)
+  {
+    plugmodel->runAllCommands();
+    setup_fun(c, plugmodel->baseScenario());
+    plugmodel->runAllCommands();
+  }
+
+  clock->play(t);
+  m_guests.push_back({&doc, std::move(clock)});
+  doc.context().execTimer.start();
+}
+
 void ApplicationPlugin::on_record(::TimeVal t)
 {
   SCORE_ASSERT(!m_playing);
@@ -589,73 +668,170 @@ void ApplicationPlugin::on_record(::TimeVal t)
 
 void ApplicationPlugin::on_stop()
 {
+  // Stop only affects the displayed document when it plays ; from another
+  // document, it stops all of the documents which are playing.
+  auto doc = currentDocument();
+  if (doc && isPlaying(*doc))
+    stop(*doc);
+  else
+    stopAll();
+}
+
+void ApplicationPlugin::stopAll()
+{
+  while (!m_guests.empty())
+    stop(*m_guests.back().document);
+
+  if (m_clock)
+  {
+    stop(m_clock->context.doc.document);
+    return;
+  }
+
   if (audio)
   {
     audio->reload(nullptr);
   }
+  mixer.setHost(nullptr);
   m_playing = false;
   m_paused = false;
 
-  if (m_clock)
+  if (auto doc = currentDocument())
+    on_executionStopped(*doc);
+}
+
+bool ApplicationPlugin::isPlaying(const score::Document& doc) const noexcept
+{
+  if (m_clock && &m_clock->context.doc.document == &doc)
+    return true;
+
+  return std::any_of(m_guests.begin(), m_guests.end(), [&](auto& g) {
+    return g.document == &doc;
+  });
+}
+
+void ApplicationPlugin::stop(score::Document& doc)
+{
+  auto it = std::find_if(m_guests.begin(), m_guests.end(), [&](auto& g) {
+    return g.document == &doc;
+  });
+  if (it != m_guests.end())
+  {
+    auto clock = std::move(it->clock);
+    m_guests.erase(it);
+    clock->stop();
+  }
+  else if (m_clock && &m_clock->context.doc.document == &doc)
   {
     m_clock->stop();
     m_clock.reset();
+
+    // The other documents keep playing: the first of them takes over
+    if (!m_guests.empty())
+    {
+      m_clock = std::move(m_guests.front().clock);
+      m_guests.erase(m_guests.begin());
+      m_paused = m_clock->paused();
+    }
+  }
+  else
+  {
+    return;
   }
 
-  if (auto doc = currentDocument())
+  if (!m_clock)
   {
-    doc->context().execTimer.stop();
-    auto plugmodel = doc->context().findPlugin<Execution::DocumentPlugin>();
-    if (!plugmodel)
-      return;
-    else
+    if (audio)
     {
-      // plugmodel->clear();
+      audio->reload(nullptr);
     }
-    // If we can we resume listening
-    if (!context.docManager.preparingNewDocument())
+    mixer.setHost(nullptr);
+    m_playing = false;
+    m_paused = false;
+  }
+
+  on_executionStopped(doc);
+}
+
+void ApplicationPlugin::releaseAudio(Execution::DocumentPlugin& plug)
+{
+  if (mixer.host() != &plug)
+    return;
+
+  // The audio protocol of the document still runs the other documents
+  auto next
+      = m_clock ? &m_clock->context.doc.plugin<Execution::DocumentPlugin>()
+                : nullptr;
+  if (next && !next->audio_device)
+    next = nullptr;
+
+  if (audio)
+  {
+    if (next)
     {
-      auto explorer = Explorer::try_deviceExplorerFromObject(*doc);
-      if (explorer)
-        explorer->deviceModel().listening().restore();
+      next->audioProto().stop();
+      audio->reload(&next->audioProto());
     }
+    else
+    {
+      audio->reload(nullptr);
+    }
+  }
+  mixer.setHost(next);
+}
 
-    QTimer::singleShot(50, this, [this] {
-      auto doc = currentDocument();
-      if (!doc)
-        return;
-      auto scenar = dynamic_cast<Scenario::ScenarioDocumentModel*>(
-          &doc->model().modelDelegate());
-      if (!scenar)
-        return;
-      scenar->baseInterval().reset();
-      scenar->baseInterval().executionFinished();
-      auto procs = doc->findChildren<Scenario::ProcessModel*>();
-      for (Scenario::ProcessModel* e : procs)
+void ApplicationPlugin::on_executionStopped(score::Document& doc)
+{
+  doc.context().execTimer.stop();
+  auto plugmodel = doc.context().findPlugin<Execution::DocumentPlugin>();
+  if (!plugmodel)
+    return;
+  else
+  {
+    // plugmodel->clear();
+  }
+  // If we can we resume listening
+  if (!context.docManager.preparingNewDocument())
+  {
+    auto explorer = Explorer::try_deviceExplorerFromObject(doc);
+    if (explorer)
+      explorer->deviceModel().listening().restore();
+  }
+
+  QTimer::singleShot(50, this, [doc = QPointer<score::Document>{&doc}] {
+    if (!doc)
+      return;
+    auto scenar = dynamic_cast<Scenario::ScenarioDocumentModel*>(
+        &doc->model().modelDelegate());
+    if (!scenar)
+      return;
+    scenar->baseInterval().reset();
+    scenar->baseInterval().executionFinished();
+    auto procs = doc->findChildren<Scenario::ProcessModel*>();
+    for (Scenario::ProcessModel* e : procs)
+    {
+      for (auto& itv : e->intervals)
       {
-        for (auto& itv : e->intervals)
-        {
-          itv.reset();
-          itv.executionFinished();
-        }
-        for (auto& ev : e->events)
-        {
-          ev.setStatus(Scenario::ExecutionStatus::Editing, *e);
-        }
+        itv.reset();
+        itv.executionFinished();
       }
-
-      auto loops = doc->findChildren<Loop::ProcessModel*>();
-      for (Loop::ProcessModel* lp : loops)
+      for (auto& ev : e->events)
       {
-        lp->interval().reset();
-        lp->interval().executionFinished();
-        lp->startEvent().setStatus(Scenario::ExecutionStatus::Editing, *lp);
-        lp->endEvent().setStatus(Scenario::ExecutionStatus::Editing, *lp);
-        lp->startState().setStatus(Scenario::ExecutionStatus::Editing);
-        lp->endState().setStatus(Scenario::ExecutionStatus::Editing);
+        ev.setStatus(Scenario::ExecutionStatus::Editing, *e);
       }
-    });
-  }
+    }
+
+    auto loops = doc->findChildren<Loop::ProcessModel*>();
+    for (Loop::ProcessModel* lp : loops)
+    {
+      lp->interval().reset();
+      lp->interval().executionFinished();
+      lp->startEvent().setStatus(Scenario::ExecutionStatus::Editing, *lp);
+      lp->endEvent().setStatus(Scenario::ExecutionStatus::Editing, *lp);
+      lp->startState().setStatus(Scenario::ExecutionStatus::Editing);
+      lp->endState().setStatus(Scenario::ExecutionStatus::Editing);
+    }
+  });
 }
 
 void ApplicationPlugin::on_init()
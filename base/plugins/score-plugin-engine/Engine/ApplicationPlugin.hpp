@@ -8,9 +8,11 @@
 #include <QString>
 
 #include <Execution/ContextMenu/PlayContextMenu.hpp>
+#include <Execution/Dataflow/DocumentMixer.hpp>
 #include <score_plugin_engine_export.h>
 
 #include <memory>
+#include <vector>
 
 namespace Scenario
 {
@@ -20,6 +22,7 @@ namespace Execution
 {
 struct Context;
 class Clock;
+class DocumentPlugin;
 class BaseScenarioElement;
 }
 
@@ -73,9 +76,20 @@ public:
     return m_paused;
   }
 
+  //! Stops the current document: the other documents keep playing.
   void on_stop();
+  void stopAll();
+
+  //! Whether the document plays, alone or alongside other documents.
+  bool isPlaying(const score::Document& doc) const noexcept;
+  void stop(score::Document& doc);
+
+  //! Called when a document closes: if the audio engine runs its audio
+  //! protocol, it is handed over to another playing document.
+  void releaseAudio(Execution::DocumentPlugin& plug);
 
   std::unique_ptr<ossia::audio_engine> audio;
+  Execution::DocumentMixer mixer;
 
 private:
   void on_init();
@@ -87,7 +101,21 @@ private:
 
   Execution::PlayContextMenu m_playActions;
 
+  void on_executionStopped(score::Document& doc);
+  void playGuest(
+      score::Document& doc, Scenario::IntervalModel& cst,
+      exec_setup_fun setup_fun, ::TimeVal t);
+
+  //! The document which started playing first: the transport and the time
+  //! displayed follow it. When it stops, the next one takes over.
   std::unique_ptr<Execution::Clock> m_clock;
+
+  struct Guest
+  {
+    score::Document* document{};
+    std::unique_ptr<Execution::Clock> clock;
+  };
+  std::vector<Guest> m_guests;
   QAction* m_audioEngineAct{};
   QToolBar* m_speedToolbar{};
   bool m_playing{false}, m_paused{false};
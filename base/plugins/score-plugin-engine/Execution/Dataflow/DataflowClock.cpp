@@ -10,9 +10,21 @@
 #include <ossia/dataflow/graph/graph_interface.hpp>
 
 #include <Audio/Settings/Model.hpp>
+#include <Engine/ApplicationPlugin.hpp>
+#include <Execution/Dataflow/DocumentMixer.hpp>
 #include <Execution/Settings/ExecutorModel.hpp>
+
+#include <chrono>
 namespace Dataflow
 {
+namespace
+{
+Execution::DocumentMixer& mixer(const Execution::Context& ctx)
+{
+  return ctx.doc.app.guiApplicationPlugin<Engine::ApplicationPlugin>().mixer;
+}
+}
+
 Clock::Clock(const Execution::Context& ctx)
     : Execution::Clock{ctx}
     , m_default{ctx}
@@ -38,7 +50,8 @@ void Clock::play_impl(const TimeVal& t, Execution::BaseScenarioElement& bs)
 void Clock::pause_impl(Execution::BaseScenarioElement& bs)
 {
   m_paused = true;
-  m_plug.audioProto().set_tick([](auto&&...) {});
+  // Only this document stops being ticked: the others keep playing.
+  mixer(context).remove(m_plug);
   m_default.pause();
 }
 
@@ -66,13 +79,14 @@ void Clock::resume_impl(Execution::BaseScenarioElement& bs)
   else if (commit == Execution::Settings::CommitPolicies{}.Merged)
     opt.commit = ossia::tick_setup_options::Merged;
 
+  auto exec_tick = ossia::make_tick(
+      opt, *m_plug.execState, *m_plug.execGraph,
+      *m_cur->baseInterval().OSSIAInterval());
+
+  Execution::DocumentMixer::tick_fun fun;
   if (m_plug.settings.getBench() && m_plug.bench)
   {
-    auto tick = ossia::make_tick(
-        opt, *m_plug.execState, *m_plug.execGraph,
-        *m_cur->baseInterval().OSSIAInterval());
-
-    m_plug.audioProto().set_tick([tick, plug = &m_plug](auto&&... args) {
+    fun = [exec_tick, plug = &m_plug](unsigned long frames, double secs) {
       // Run some commands if they have been submitted.
       Execution::ExecutionCommand c;
       while (plug->context().executionQueue.try_dequeue(c))
@@ -82,11 +96,11 @@ void Clock::resume_impl(Execution::BaseScenarioElement& bs)
 
       auto& bench = *plug->bench;
       static int i = 0;
+      auto t0 = std::chrono::steady_clock::now();
       if (i % 50 == 0)
       {
         bench.measure = true;
-        auto t0 = std::chrono::steady_clock::now();
-        tick(args...);
+        exec_tick(frames, secs);
         auto t1 = std::chrono::steady_clock::now();
         auto total
             = std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
@@ -101,19 +115,20 @@ void Clock::resume_impl(Execution::BaseScenarioElement& bs)
       else
       {
         bench.measure = false;
-        tick(args...);
+        exec_tick(frames, secs);
       }
+      auto t1 = std::chrono::steady_clock::now();
+      Execution::DocumentMixer::updateLoad(
+          *plug, frames,
+          std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+              .count());
 
       i++;
-    });
+    };
   }
   else
   {
-    auto tick = ossia::make_tick(
-        opt, *m_plug.execState, *m_plug.execGraph,
-        *m_cur->baseInterval().OSSIAInterval());
-
-    m_plug.audioProto().set_tick([tick, plug = &m_plug](auto&&... args) {
+    fun = [exec_tick, plug = &m_plug](unsigned long frames, double secs) {
       // Run some commands if they have been submitted.
       Execution::ExecutionCommand c;
       while (plug->context().executionQueue.try_dequeue(c))
@@ -121,17 +136,25 @@ void Clock::resume_impl(Execution::BaseScenarioElement& bs)
         c();
       }
 
-      tick(args...);
-    });
+      auto t0 = std::chrono::steady_clock::now();
+      exec_tick(frames, secs);
+      auto t1 = std::chrono::steady_clock::now();
+      Execution::DocumentMixer::updateLoad(
+          *plug, frames,
+          std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0)
+              .count());
+    };
   }
+
+  // The audio engine ticks the mixer, which ticks all the playing documents
+  mixer(context).add(m_plug, std::move(fun));
 }
 
 void Clock::stop_impl(Execution::BaseScenarioElement& bs)
 {
   m_paused = false;
 
-  auto& proto = m_plug.audioProto();
-  proto.set_tick([](unsigned long, double) {});
+  mixer(context).remove(m_plug);
 
   m_plug.finished();
   m_default.stop();
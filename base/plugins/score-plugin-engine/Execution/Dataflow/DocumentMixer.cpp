@@ -0,0 +1,147 @@
+#include "DocumentMixer.hpp"
+
+#include <Protocols/Audio/AudioDevice.hpp>
+
+#include <ossia/audio/audio_parameter.hpp>
+#include <ossia/audio/audio_protocol.hpp>
+#include <ossia/dataflow/execution_state.hpp>
+#include <ossia/network/base/node_functions.hpp>
+
+#include <Execution/DocumentPlugin.hpp>
+
+#include <algorithm>
+#include <thread>
+
+namespace Execution
+{
+namespace
+{
+ossia::audio_parameter* findAudio(DocumentPlugin& plug, const char* path)
+{
+  if (!plug.audio_device)
+    return nullptr;
+
+  auto dev = plug.audio_device->getDevice();
+  if (!dev)
+    return nullptr;
+
+  if (auto node = ossia::net::find_node(dev->get_root_node(), path))
+    return dynamic_cast<ossia::audio_parameter*>(node->get_parameter());
+  return nullptr;
+}
+}
+
+DocumentMixer::DocumentMixer() = default;
+DocumentMixer::~DocumentMixer()
+{
+  publish(nullptr);
+}
+
+void DocumentMixer::publish(std::unique_ptr<Mix> mix)
+{
+  auto prev = std::move(m_mix);
+  m_mix = std::move(mix);
+  m_current.store(m_mix.get());
+
+  // The audio thread may still be going through the previous list
+  while (m_running.load())
+    std::this_thread::yield();
+}
+
+void DocumentMixer::setHost(DocumentPlugin* host)
+{
+  if (m_host == host)
+    return;
+
+  if (m_host && m_host->audio_device)
+    m_host->audioProto().set_tick([](unsigned long, double) {});
+
+  auto mix = m_mix ? std::make_unique<Mix>(*m_mix) : std::make_unique<Mix>();
+  mix->hostIn = host ? findAudio(*host, "/in/main") : nullptr;
+  mix->hostOut = host ? findAudio(*host, "/out/main") : nullptr;
+  publish(std::move(mix));
+
+  m_host = host;
+  if (m_host && m_host->audio_device)
+    m_host->audioProto().set_tick(
+        [this](unsigned long frames, double secs) { run(frames, secs); });
+}
+
+void DocumentMixer::add(DocumentPlugin& plug, tick_fun tick)
+{
+  auto mix = m_mix ? std::make_unique<Mix>(*m_mix) : std::make_unique<Mix>();
+  Entry e{&plug, std::move(tick), findAudio(plug, "/in/main"),
+          findAudio(plug, "/out/main")};
+
+  auto it = std::find_if(
+      mix->entries.begin(), mix->entries.end(),
+      [&](auto& other) { return other.plug == &plug; });
+  if (it != mix->entries.end())
+    *it = std::move(e);
+  else
+    mix->entries.push_back(std::move(e));
+
+  publish(std::move(mix));
+}
+
+void DocumentMixer::remove(DocumentPlugin& plug)
+{
+  if (!contains(plug))
+    return;
+
+  auto mix = std::make_unique<Mix>(*m_mix);
+  mix->entries.erase(
+      std::remove_if(
+          mix->entries.begin(), mix->entries.end(),
+          [&](auto& e) { return e.plug == &plug; }),
+      mix->entries.end());
+
+  // Once published, the audio thread is not in the tick of the
+  // document anymore and it can be stopped safely.
+  publish(std::move(mix));
+}
+
+bool DocumentMixer::contains(const DocumentPlugin& plug) const noexcept
+{
+  if (!m_mix)
+    return false;
+
+  return std::any_of(
+      m_mix->entries.begin(), m_mix->entries.end(),
+      [&](auto& e) { return e.plug == &plug; });
+}
+
+void DocumentMixer::run(unsigned long frames, double seconds) noexcept
+{
+  m_running.store(true);
+  if (auto mix = m_current.load())
+  {
+    for (auto& e : mix->entries)
+    {
+      // The other documents read the input of the host and mix in its
+      // output, with the gain of their own main output.
+      if (e.in && mix->hostIn && e.in != mix->hostIn)
+        e.in->audio = mix->hostIn->audio;
+      if (e.out && mix->hostOut && e.out != mix->hostOut)
+        e.out->audio = mix->hostOut->audio;
+
+      e.tick(frames, seconds);
+    }
+  }
+  m_running.store(false);
+}
+
+void DocumentMixer::updateLoad(
+    DocumentPlugin& plug, unsigned long frames, int64_t ns) noexcept
+{
+  const double rate = plug.execState ? plug.execState->sampleRate : 0.;
+  if (frames == 0 || rate <= 0.)
+    return;
+
+  // Smoothed over a few buffers so that it can be displayed
+  const double budget = 1e9 * frames / rate;
+  const float cur = float(ns / budget);
+  const float prev = plug.cpuLoad.load(std::memory_order_relaxed);
+  plug.cpuLoad.store(prev + 0.1f * (cur - prev), std::memory_order_relaxed);
+}
+}
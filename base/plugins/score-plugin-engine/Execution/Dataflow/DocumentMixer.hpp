@@ -0,0 +1,89 @@
+#pragma once
+#include <score_plugin_engine_export.h>
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace ossia
+{
+class audio_parameter;
+}
+namespace Execution
+{
+class DocumentPlugin;
+
+/**
+ * @brief Plays several documents at the same time in the audio engine
+ *
+ * The audio engine drives the audio protocol of a single document, the
+ * host, whose tick is the one of the mixer. Each playing document, the host
+ * included, adds its own tick to the mixer and removes it when it is paused
+ * or stopped, without affecting the others: the host keeps driving the
+ * engine while it is stopped. The main audio input and output of the other
+ * documents are bound to the buffers of the host, so that they are mixed
+ * in its output. Each document keeps its own graph, execution state, and
+ * gain of its main output.
+ *
+ * The ticks are changed from the GUI thread, by swapping the whole list
+ * atomically: the audio thread never waits nor skips a document. The GUI
+ * thread waits for the end of the current buffer before freeing the
+ * previous list, so that once add or remove returns, the previous tick of
+ * the document is not running anymore.
+ */
+class SCORE_PLUGIN_ENGINE_EXPORT DocumentMixer
+{
+public:
+  using tick_fun = std::function<void(unsigned long, double)>;
+
+  DocumentMixer();
+  ~DocumentMixer();
+
+  DocumentPlugin* host() const noexcept
+  {
+    return m_host;
+  }
+
+  //! Sets the mixer as the tick of the audio protocol of the host,
+  //! which must be the one loaded in the audio engine.
+  void setHost(DocumentPlugin* host);
+
+  void add(DocumentPlugin& plug, tick_fun tick);
+  void remove(DocumentPlugin& plug);
+  bool contains(const DocumentPlugin& plug) const noexcept;
+
+  //! Called by the audio protocol of the host, on the audio thread.
+  void run(unsigned long frames, double seconds) noexcept;
+
+  //! Updates the load of a document from the time spent in its tick.
+  static void updateLoad(
+      DocumentPlugin& plug, unsigned long frames, int64_t ns) noexcept;
+
+private:
+  struct Entry
+  {
+    DocumentPlugin* plug{};
+    tick_fun tick;
+    ossia::audio_parameter* in{};
+    ossia::audio_parameter* out{};
+  };
+
+  struct Mix
+  {
+    ossia::audio_parameter* hostIn{};
+    ossia::audio_parameter* hostOut{};
+    std::vector<Entry> entries;
+  };
+
+  void publish(std::unique_ptr<Mix> mix);
+
+  DocumentPlugin* m_host{};
+
+  // Owned by the GUI thread, read by the audio thread through m_current
+  std::unique_ptr<Mix> m_mix;
+  std::atomic<const Mix*> m_current{};
+  std::atomic_bool m_running{};
+};
+}
@@ -90,8 +90,19 @@ DocumentPlugin::DocumentPlugin(
 
   con(m_base, &Execution::BaseScenarioElement::finished, this,
       [=] {
-        auto& stop_action = context().doc.app.actions.action<Actions::Stop>();
-        stop_action.action()->trigger();
+        auto& app = context().doc.app;
+        auto& engine = app.guiApplicationPlugin<Engine::ApplicationPlugin>();
+        auto& doc = context().doc.document;
+        // Only this document stops, the others keep playing
+        if (engine.currentDocument() != &doc)
+        {
+          engine.stop(doc);
+        }
+        else
+        {
+          auto& stop_action = app.actions.action<Actions::Stop>();
+          stop_action.action()->trigger();
+        }
       },
       Qt::QueuedConnection);
 
@@ -250,10 +261,13 @@ void DocumentPlugin::reload(Scenario::IntervalModel& cst)
 
   makeGraph();
 
-  if (app.audio && audio_device)
+  // When the audio engine already runs the audio protocol of a document,
+  // this one is mixed in it instead of replacing it.
+  if (app.audio && audio_device && !app.mixer.host())
   {
     audioProto().stop();
     app.audio->reload(&audioProto());
+    app.mixer.setHost(this);
   }
 
   auto parent = dynamic_cast<Scenario::ScenarioInterface*>(cst.parent());
@@ -295,14 +309,17 @@ void DocumentPlugin::clear()
 
 void DocumentPlugin::on_documentClosing()
 {
+  const score::DocumentContext& ctx = m_ctx.doc;
+  auto& engine = ctx.app.guiApplicationPlugin<Engine::ApplicationPlugin>();
   if (m_base.active())
   {
     m_base.baseInterval().stop();
-    m_ctx.context()
-        .doc.app.guiApplicationPlugin<Engine::ApplicationPlugin>()
-        .on_stop();
+    engine.stop(ctx.document);
     clear();
   }
+
+  // The other documents may still play through the audio of this one
+  engine.releaseAudio(*this);
 }
 
 const BaseScenarioElement& DocumentPlugin::baseScenario() const
@@ -74,6 +74,10 @@ public:
   std::shared_ptr<ossia::execution_state> execState;
   std::shared_ptr<ossia::bench_map> bench;
 
+  //! Time spent in the tick of the document relative to the buffer
+  //! duration, set from the audio thread.
+  std::atomic<float> cpuLoad{};
+
   QPointer<Dataflow::AudioDevice> audio_device{};
   QPointer<Device::DeviceInterface> local_device{};
 
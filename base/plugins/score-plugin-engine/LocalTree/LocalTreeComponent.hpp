@@ -4,6 +4,9 @@
 #include <LocalTree/LocalTreeDocumentPlugin.hpp>
 #include <LocalTree/NameProperty.hpp>
 
+#include <functional>
+#include <vector>
+
 namespace LocalTree
 {
 template <typename Component_T>
@@ -14,6 +17,17 @@ public:
   Component(ossia::net::node_base& n, score::ModelMetadata& m, Args&&... args)
       : Component_T{std::forward<Args>(args)...}, m_thisNode{n, m, this}
   {
+    m_materialized = !this->system().lazy() || isRemoteControllable(m);
+    if (!m_materialized)
+    {
+      QObject::connect(
+          &m, &score::ModelMetadata::ExtendedMetadataChanged, this,
+          [this, &m] {
+            if (isRemoteControllable(m))
+              materialize();
+          });
+    }
+
     add<score::ModelMetadata::p_comment>(m);
     add<score::ModelMetadata::p_label>(m);
   }
@@ -23,26 +37,58 @@ public:
     return m_thisNode.node;
   }
 
+  //! Creates the parameters which were deferred in lazy mode
+  void materialize()
+  {
+    if (m_materialized)
+      return;
+
+    m_materialized = true;
+    auto deferred = std::move(m_deferred);
+    m_deferred.clear();
+    for (auto& f : deferred)
+      f();
+  }
+
   auto& context() const
   {
     return this->system().context();
   }
 
 protected:
+  //! Creates the parameters of the element now, or in materialize()
+  //! if the local tree is lazy and the element is not remote-controllable.
+  template <typename F>
+  void defer(F&& f)
+  {
+    if (m_materialized)
+      f();
+    else
+      m_deferred.emplace_back(std::forward<F>(f));
+  }
+
   template <typename Property, typename Object>
   void add(Object& obj)
   {
-    m_properties.push_back(add_property<Property>(node(), obj, this));
+    defer([this, &obj] {
+      m_properties.push_back(add_property<Property>(node(), obj, this));
+    });
   }
 
   template <typename Property, typename Object>
   void add_get(Object& obj)
   {
-    m_properties.push_back(add_getProperty<Property>(node(), obj, this));
+    defer([this, &obj] {
+      m_properties.push_back(add_getProperty<Property>(node(), obj, this));
+    });
   }
 
   MetadataNamePropertyWrapper m_thisNode;
   std::vector<std::unique_ptr<BaseProperty>> m_properties;
+
+private:
+  std::vector<std::function<void()>> m_deferred;
+  bool m_materialized{};
 };
 
 using CommonComponent = Component<score::GenericComponent<DocumentPlugin>>;
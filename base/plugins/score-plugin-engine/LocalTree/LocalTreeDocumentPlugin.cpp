@@ -8,6 +8,7 @@
 #include <Protocols/Local/LocalSpecificSettings.hpp>
 #include <Scenario/Document/ScenarioDocument/ScenarioDocumentModel.hpp>
 
+#include <score/model/ModelMetadata.hpp>
 #include <score/tools/IdentifierGeneration.hpp>
 
 #include <core/document/Document.hpp>
@@ -18,6 +19,15 @@
 
 #include <LocalTree/Scenario/IntervalComponent.hpp>
 
+namespace LocalTree
+{
+bool isRemoteControllable(const score::ModelMetadata& m)
+{
+  return m.getExtendedMetadata().value(QStringLiteral("RemoteControl"))
+      .toBool();
+}
+}
+
 LocalTree::DocumentPlugin::DocumentPlugin(
     const score::DocumentContext& ctx, Id<score::DocumentPlugin> id,
     QObject* parent)
@@ -57,6 +67,13 @@ void LocalTree::DocumentPlugin::init()
       },
       Qt::QueuedConnection);
 
+  con(set, &Explorer::Settings::Model::LazyLocalTreeChanged, this,
+      [=](bool) {
+        if (m_root)
+          create();
+      },
+      Qt::QueuedConnection);
+
   auto docplug = context().findPlugin<Explorer::DeviceDocumentPlugin>();
   if (docplug)
     docplug->list().setLocalDevice(&m_localDeviceWrapper);
@@ -77,6 +94,9 @@ void LocalTree::DocumentPlugin::create()
   if (!scenar)
     return;
 
+  auto& set = m_context.app.settings<Explorer::Settings::Model>();
+  m_lazy = set.getLazyLocalTree();
+
   auto& cstr = scenar->baseInterval();
   m_root = new Interval(
       m_localDevice->get_root_node(), getStrongId(cstr.components()), cstr,
@@ -26,6 +26,12 @@ class StateModel;
 namespace LocalTree
 {
 class Interval;
+
+//! True if the "RemoteControl" extended metadata of the element is set.
+//! In lazy mode, only these elements get their parameters created.
+SCORE_PLUGIN_ENGINE_EXPORT
+bool isRemoteControllable(const score::ModelMetadata& m);
+
 class SCORE_PLUGIN_ENGINE_EXPORT DocumentPlugin final
     : public score::DocumentPlugin
 {
@@ -53,6 +59,13 @@ public:
     return m_localDeviceWrapper;
   }
 
+  //! If true, only the nodes of the elements are created, and their
+  //! parameters only once they are flagged as remote-controllable.
+  bool lazy() const noexcept
+  {
+    return m_lazy;
+  }
+
 private:
   void create();
   void cleanup();
@@ -60,5 +73,6 @@ private:
   Interval* m_root{};
   std::unique_ptr<ossia::net::device_base> m_localDevice;
   Engine::Network::LocalDevice m_localDeviceWrapper;
+  bool m_lazy{};
 };
 }
@@ -44,6 +44,9 @@ public:
   }
 
 private:
+  //! The process is materialized when the interval is
+  ProcessComponent* follow(ProcessComponent* comp);
+
   ossia::net::node_base& m_processesNode;
 };
 
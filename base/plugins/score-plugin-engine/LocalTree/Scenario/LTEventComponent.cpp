@@ -10,52 +10,54 @@ Event::Event(
     : CommonComponent{parent, event.metadata(), doc,
                       id,     "EventComponent", parent_comp}
 {
-  auto exp_n = node().create_child("expression");
-  auto exp_a = exp_n->create_parameter(ossia::val_type::STRING);
-  exp_a->set_access(ossia::access_mode::BI);
+  defer([this, &event] {
+    auto exp_n = node().create_child("expression");
+    auto exp_a = exp_n->create_parameter(ossia::val_type::STRING);
+    exp_a->set_access(ossia::access_mode::BI);
 
-  exp_a->add_callback([&](const ossia::value& v) {
-    if (m_setting)
-      return;
+    exp_a->add_callback([this, &event](const ossia::value& v) {
+      if (m_setting)
+        return;
 
-    auto expr = v.target<std::string>();
-    if (expr)
-    {
-      auto expr_p = ::State::parseExpression(*expr);
-      if (expr_p && expr_p != event.condition())
-        event.setCondition(*std::move(expr_p));
-    }
-  });
+      auto expr = v.target<std::string>();
+      if (expr)
+      {
+        auto expr_p = ::State::parseExpression(*expr);
+        if (expr_p && expr_p != event.condition())
+          event.setCondition(*std::move(expr_p));
+      }
+    });
 
-  QObject::connect(
-      &event, &Scenario::EventModel::conditionChanged, this,
-      [=](const ::State::Expression& cond) {
-        m_setting = true;
-        // TODO try to simplify the other get / set properties like this
-        ossia::value newVal = cond.toString().toStdString();
-        try
-        {
-          auto res = exp_a->value();
-          if (auto str = res.target<std::string>())
+    QObject::connect(
+        &event, &Scenario::EventModel::conditionChanged, this,
+        [=](const ::State::Expression& cond) {
+          m_setting = true;
+          // TODO try to simplify the other get / set properties like this
+          ossia::value newVal = cond.toString().toStdString();
+          try
           {
-            if (::State::parseExpression(*str) != cond)
+            auto res = exp_a->value();
+            if (auto str = res.target<std::string>())
+            {
+              if (::State::parseExpression(*str) != cond)
+              {
+                exp_a->push_value(std::move(newVal));
+              }
+            }
+            else
             {
               exp_a->push_value(std::move(newVal));
             }
           }
-          else
+          catch (...)
           {
-            exp_a->push_value(std::move(newVal));
           }
-        }
-        catch (...)
-        {
-        }
 
-        m_setting = false;
-      },
-      Qt::QueuedConnection);
+          m_setting = false;
+        },
+        Qt::QueuedConnection);
 
-  exp_a->set_value(event.condition().toString().toStdString());
+    exp_a->set_value(event.condition().toString().toStdString());
+  });
 }
 }
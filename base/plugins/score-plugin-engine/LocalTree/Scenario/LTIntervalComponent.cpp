@@ -4,6 +4,8 @@
 
 #include <ossia/detail/algorithms.hpp>
 #include <State/Expression.hpp>
+
+#include <QPointer>
 namespace State::convert
 {
 
@@ -89,25 +91,27 @@ public:
       DocumentPlugin& doc, const Id<score::Component>& id, QObject* parent)
     : ProcessComponent{node, proc, doc, id, "ProcessComponent", parent}
   {
-    for(Process::Inlet* inlet : proc.inlets())
-    {
-      m_properties.push_back(add_property<Process::Inlet::p_address>(this->node(), *inlet, inlet->customData().toStdString(), this));
-      auto& port_node = m_properties.back()->addr.get_node();
-      if(auto control = dynamic_cast<Process::ControlInlet*>(inlet))
+    defer([this, &proc] {
+      for(Process::Inlet* inlet : proc.inlets())
       {
-        m_properties.push_back(add_value_property<Process::ControlInlet::p_value>(port_node, *control, "value", this));
+        m_properties.push_back(add_property<Process::Inlet::p_address>(this->node(), *inlet, inlet->customData().toStdString(), this));
+        auto& port_node = m_properties.back()->addr.get_node();
+        if(auto control = dynamic_cast<Process::ControlInlet*>(inlet))
+        {
+          m_properties.push_back(add_value_property<Process::ControlInlet::p_value>(port_node, *control, "value", this));
+        }
       }
-    }
 
-    for(auto& outlet : proc.outlets())
-    {
-      m_properties.push_back(add_property<Process::Outlet::p_address>(this->node(), *outlet, outlet->customData().toStdString(), this));
-      auto& port_node = m_properties.back()->addr.get_node();
-      if(auto control = dynamic_cast<Process::ControlOutlet*>(outlet))
+      for(auto& outlet : proc.outlets())
       {
-        m_properties.push_back(add_value_property<Process::ControlOutlet::p_value>(port_node, *control, "value", this));
+        m_properties.push_back(add_property<Process::Outlet::p_address>(this->node(), *outlet, outlet->customData().toStdString(), this));
+        auto& port_node = m_properties.back()->addr.get_node();
+        if(auto control = dynamic_cast<Process::ControlOutlet*>(outlet))
+        {
+          m_properties.push_back(add_value_property<Process::ControlOutlet::p_value>(port_node, *control, "value", this));
+        }
       }
-    }
+    });
   }
 };
 
@@ -134,12 +138,26 @@ ProcessComponent* IntervalBase::make(
     const Id<score::Component>& id, ProcessComponentFactory& factory,
     Process::ProcessModel& process)
 {
-  return factory.make(id, m_processesNode, process, system(), this);
+  return follow(factory.make(id, m_processesNode, process, system(), this));
 }
 
 ProcessComponent*IntervalBase::make(const Id<score::Component>& id, Process::ProcessModel& process)
 {
-  return new DefaultProcessComponent{m_processesNode, process, system(), id, this};
+  return follow(new DefaultProcessComponent{m_processesNode, process, system(), id, this});
+}
+
+ProcessComponent* IntervalBase::follow(ProcessComponent* comp)
+{
+  // Processes have no remote control flag of their own in the inspector:
+  // their parameters are created along with the ones of their interval.
+  if (comp)
+  {
+    defer([comp = QPointer<ProcessComponent>{comp}] {
+      if (comp)
+        comp->materialize();
+    });
+  }
+  return comp;
 }
 
 bool IntervalBase::removing(
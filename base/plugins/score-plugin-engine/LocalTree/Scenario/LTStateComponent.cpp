@@ -17,19 +17,21 @@ State::State(
     : CommonComponent{parent, state.metadata(), doc,
                       id,     "StateComponent", parent_comp}
 {
-  m_properties.push_back(
-      add_setProperty<::State::impulse>(node(), "trigger", [&doc,s=QPointer<Scenario::StateModel>(&state)](auto) {
-        if(s)
-        {
-          auto plug = doc.context()
-                          .app.findGuiApplicationPlugin<
-                              Scenario::ScenarioApplicationPlugin>();
-          if (plug)
+  defer([this, &doc, &state] {
+    m_properties.push_back(
+        add_setProperty<::State::impulse>(node(), "trigger", [&doc,s=QPointer<Scenario::StateModel>(&state)](auto) {
+          if(s)
           {
-            plug->execution().playState(
-                Scenario::parentScenario(*s), s->id());
+            auto plug = doc.context()
+                            .app.findGuiApplicationPlugin<
+                                Scenario::ScenarioApplicationPlugin>();
+            if (plug)
+            {
+              plug->execution().playState(
+                  Scenario::parentScenario(*s), s->id());
+            }
           }
-        }
-      }));
+        }));
+  });
 }
 }
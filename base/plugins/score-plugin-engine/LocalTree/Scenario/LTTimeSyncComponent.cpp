@@ -13,10 +13,12 @@ TimeSync::TimeSync(
     : CommonComponent{parent, timeSync.metadata(), doc,
                       id,     "TimeSyncComponent", parent_comp}
 {
-  m_properties.push_back(
-              add_setProperty<::State::impulse>(
-                  node(), "trigger", [t=QPointer<Scenario::TimeSyncModel>{&timeSync}] (auto) {
-      if(t) t->triggeredByGui();
-  }));
+  defer([this, &timeSync] {
+    m_properties.push_back(
+                add_setProperty<::State::impulse>(
+                    node(), "trigger", [t=QPointer<Scenario::TimeSyncModel>{&timeSync}] (auto) {
+        if(t) t->triggeredByGui();
+    }));
+  });
 }
 }
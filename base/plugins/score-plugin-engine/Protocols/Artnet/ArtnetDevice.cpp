@@ -1,9 +1,9 @@
 
 #include "ArtnetDevice.hpp"
 
+#include "ArtnetProtocol.hpp"
 #include "ArtnetSpecificSettings.hpp"
 
-#include <ossia/network/artnet/artnet_protocol.hpp>
 #include <ossia/network/generic/generic_device.hpp>
 #include <wobjectimpl.h>
 W_OBJECT_IMPL(Engine::Network::ArtnetDevice)
@@ -33,8 +33,9 @@ bool ArtnetDevice::reconnect()
   try
   {
     auto addr = std::make_unique<ossia::net::generic_device>(
-        std::make_unique<ossia::net::artnet_protocol>(
-            20), //  20 Hz update rate : TODO add control on widget
+        std::make_unique<ArtnetProtocol>(
+            settings()
+                .deviceSpecificSettings.value<ArtnetSpecificSettings>()),
         settings().name.toStdString());
     m_dev = std::move(addr);
     deviceChanged(nullptr, m_dev.get());
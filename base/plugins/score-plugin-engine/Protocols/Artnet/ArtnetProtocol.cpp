@@ -0,0 +1,160 @@
+#include "ArtnetProtocol.hpp"
+
+#include <ossia/network/base/device.hpp>
+#include <ossia/network/base/node.hpp>
+#include <ossia/network/base/parameter.hpp>
+#include <ossia/network/domain/domain.hpp>
+#include <ossia/network/generic/generic_node.hpp>
+#include <ossia/network/value/value_conversion.hpp>
+
+#include <algorithm>
+#include <string>
+
+namespace Engine::Network
+{
+namespace
+{
+constexpr uint16_t artnet_port = 6454;
+constexpr std::size_t header_size = 18;
+}
+
+DMXChannelParameter::DMXChannelParameter(
+    ossia::net::node_base& node, DMXUniverse& universe, uint16_t index)
+    : ossia::net::device_parameter{node,
+                                   ossia::val_type::INT,
+                                   ossia::bounding_mode::CLIP,
+                                   ossia::access_mode::SET,
+                                   ossia::make_domain(0, 255)}
+    , m_universe{universe}
+    , m_index{index}
+{
+}
+
+void DMXChannelParameter::device_update_value()
+{
+  m_universe.channels[m_index].store(
+      std::clamp(ossia::convert<int>(m_current_value), 0, 255),
+      std::memory_order_relaxed);
+  m_universe.dirty.store(true, std::memory_order_release);
+}
+
+ArtnetProtocol::ArtnetProtocol(const ArtnetSpecificSettings& settings)
+    : m_settings{settings}
+    , m_universes(std::max(1, settings.universes))
+    , m_socket{m_service, asio::ip::udp::v4()}
+    , m_target{asio::ip::address::from_string(settings.host.toStdString()),
+               artnet_port}
+{
+  m_socket.set_option(asio::socket_base::broadcast(true));
+  m_thread = std::thread{[this] { run(); }};
+}
+
+ArtnetProtocol::~ArtnetProtocol()
+{
+  {
+    std::lock_guard lock{m_mutex};
+    m_stop = true;
+  }
+  m_cv.notify_one();
+  m_thread.join();
+}
+
+void ArtnetProtocol::set_device(ossia::net::device_base& dev)
+{
+  auto& root = dev.get_root_node();
+  const std::size_t n = m_universes.size();
+  for (std::size_t u = 0; u < n; u++)
+  {
+    // With a single universe the channels stay at the root of the device,
+    // otherwise they are under the Art-Net number of their universe.
+    auto& parent = n == 1 ? root : *root.create_child(std::to_string(u));
+    for (int c = 0; c < 512; c++)
+    {
+      auto node = std::make_unique<ossia::net::generic_node>(
+          std::to_string(c + 1), dev, parent);
+      node->set_parameter(std::make_unique<DMXChannelParameter>(
+          *node, m_universes[u], uint16_t(c)));
+      parent.add_child(std::move(node));
+    }
+  }
+}
+
+bool ArtnetProtocol::pull(ossia::net::parameter_base&)
+{
+  return false;
+}
+
+bool ArtnetProtocol::push(
+    const ossia::net::parameter_base&, const ossia::value&)
+{
+  return false;
+}
+
+bool ArtnetProtocol::push_raw(const ossia::net::full_parameter_data&)
+{
+  return false;
+}
+
+bool ArtnetProtocol::observe(ossia::net::parameter_base&, bool)
+{
+  return false;
+}
+
+bool ArtnetProtocol::update(ossia::net::node_base&)
+{
+  return true;
+}
+
+void ArtnetProtocol::run()
+{
+  using clock = std::chrono::steady_clock;
+  const auto period = std::chrono::microseconds{
+      1000000 / std::clamp(m_settings.rate, 1, 1000)};
+
+  auto next = clock::now();
+  std::unique_lock lock{m_mutex};
+  for (;;)
+  {
+    next += period;
+    if (m_cv.wait_until(lock, next, [this] { return m_stop; }))
+      return;
+
+    const auto now = clock::now();
+    for (std::size_t u = 0; u < m_universes.size(); u++)
+    {
+      // Unchanged universes are still sent once per second, since
+      // receivers may release the universes they do not hear from.
+      auto& universe = m_universes[u];
+      if (universe.dirty.exchange(false, std::memory_order_acquire)
+          || now - universe.lastSent > std::chrono::seconds{1})
+      {
+        universe.lastSent = now;
+        send(universe, uint16_t(u));
+      }
+    }
+  }
+}
+
+void ArtnetProtocol::send(DMXUniverse& universe, uint16_t address)
+{
+  // ArtDMX packet
+  std::array<uint8_t, header_size + 512> packet{
+      'A', 'r', 't', '-', 'N', 'e', 't', 0,
+      0x00, 0x50, // OpDmx, little-endian
+      0, 14,      // Protocol version
+      0,          // Sequence
+      0,          // Physical port
+      uint8_t(address & 0xFF), uint8_t((address >> 8) & 0x7F),
+      0x02, 0x00  // 512 channels, big-endian
+  };
+
+  universe.sequence = universe.sequence == 255 ? 1 : universe.sequence + 1;
+  packet[12] = universe.sequence;
+  for (std::size_t i = 0; i < universe.channels.size(); i++)
+    packet[header_size + i]
+        = universe.channels[i].load(std::memory_order_relaxed);
+
+  asio::error_code ec;
+  m_socket.send_to(asio::buffer(packet), m_target, 0, ec);
+}
+}
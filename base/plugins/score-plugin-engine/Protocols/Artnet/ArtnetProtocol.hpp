@@ -0,0 +1,96 @@
+#pragma once
+#include "ArtnetSpecificSettings.hpp"
+
+#include <ossia/network/base/protocol.hpp>
+#include <ossia/network/common/device_parameter.hpp>
+
+#include <asio/io_service.hpp>
+#include <asio/ip/udp.hpp>
+#include <score_plugin_engine_export.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Engine::Network
+{
+/**
+ * @brief The 512 channels of a DMX universe
+ *
+ * Written by the parameters of the channels, from any thread, and read by
+ * the output thread of the protocol which sends it if it is dirty.
+ */
+struct DMXUniverse
+{
+  std::array<std::atomic<uint8_t>, 512> channels{};
+  std::atomic_bool dirty{true};
+
+  // Only used by the output thread
+  std::chrono::steady_clock::time_point lastSent{};
+  uint8_t sequence{};
+};
+
+/**
+ * @brief A DMX channel
+ *
+ * Pushing a value does not go through the protocol: the parameter only
+ * writes its byte in the buffer of its universe.
+ */
+class DMXChannelParameter final : public ossia::net::device_parameter
+{
+public:
+  DMXChannelParameter(
+      ossia::net::node_base& node, DMXUniverse& universe, uint16_t index);
+
+private:
+  void device_update_value() override;
+
+  DMXUniverse& m_universe;
+  uint16_t m_index{};
+};
+
+/**
+ * @brief Sends DMX universes with Art-Net
+ *
+ * Each channel is a DMXChannelParameter of the device. The universes which
+ * changed since the last tick are sent at most at the refresh rate of the
+ * device, as a single ArtDMX packet each.
+ */
+class SCORE_PLUGIN_ENGINE_EXPORT ArtnetProtocol final
+    : public ossia::net::protocol_base
+{
+public:
+  explicit ArtnetProtocol(const ArtnetSpecificSettings& settings);
+  ~ArtnetProtocol() override;
+
+  void set_device(ossia::net::device_base& dev) override;
+
+  bool pull(ossia::net::parameter_base&) override;
+  bool push(
+      const ossia::net::parameter_base&, const ossia::value& v) override;
+  bool push_raw(const ossia::net::full_parameter_data&) override;
+  bool observe(ossia::net::parameter_base&, bool) override;
+  bool update(ossia::net::node_base&) override;
+
+private:
+  void run();
+  void send(DMXUniverse& universe, uint16_t address);
+
+  const ArtnetSpecificSettings m_settings;
+  std::vector<DMXUniverse> m_universes;
+
+  asio::io_service m_service;
+  asio::ip::udp::socket m_socket;
+  asio::ip::udp::endpoint m_target;
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_stop{};
+  std::thread m_thread;
+};
+}
@@ -3,6 +3,8 @@
 
 #include <State/Widgets/AddressFragmentLineEdit.hpp>
 #include <QFormLayout>
+#include <QLineEdit>
+#include <QSpinBox>
 #include <QVariant>
 
 #include <wobjectimpl.h>
@@ -18,8 +20,25 @@ ArtnetProtocolSettingsWidget::ArtnetProtocolSettingsWidget(QWidget* parent)
   m_deviceNameEdit = new State::AddressFragmentLineEdit{this};
   m_deviceNameEdit->setText("Artnet");
 
+  m_host = new QLineEdit{this};
+
+  m_universes = new QSpinBox{this};
+  m_universes->setRange(1, 128);
+
+  m_rate = new QSpinBox{this};
+  m_rate->setRange(1, 1000);
+  m_rate->setSuffix(tr(" Hz"));
+
+  ArtnetSpecificSettings defaults;
+  m_host->setText(defaults.host);
+  m_universes->setValue(defaults.universes);
+  m_rate->setValue(defaults.rate);
+
   auto layout = new QFormLayout;
   layout->addRow(tr("Device name"), m_deviceNameEdit);
+  layout->addRow(tr("Host"), m_host);
+  layout->addRow(tr("Universes"), m_universes);
+  layout->addRow(tr("Max. refresh rate"), m_rate);
 
   setLayout(layout);
 }
@@ -34,6 +53,9 @@ Device::DeviceSettings ArtnetProtocolSettingsWidget::getSettings() const
   s.name = m_deviceNameEdit->text();
 
   ArtnetSpecificSettings settings{};
+  settings.host = m_host->text();
+  settings.universes = m_universes->value();
+  settings.rate = m_rate->value();
   s.deviceSpecificSettings = QVariant::fromValue(settings);
 
   return s;
@@ -43,5 +65,13 @@ void ArtnetProtocolSettingsWidget::setSettings(
     const Device::DeviceSettings& settings)
 {
   m_deviceNameEdit->setText(settings.name);
+  if (settings.deviceSpecificSettings.canConvert<ArtnetSpecificSettings>())
+  {
+    auto specif
+        = settings.deviceSpecificSettings.value<ArtnetSpecificSettings>();
+    m_host->setText(specif.host);
+    m_universes->setValue(specif.universes);
+    m_rate->setValue(specif.rate);
+  }
 }
 }
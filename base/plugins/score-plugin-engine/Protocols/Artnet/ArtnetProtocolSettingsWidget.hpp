@@ -5,7 +5,7 @@
 #include <wobjectdefs.h>
 
 class QLineEdit;
-class QComboBox;
+class QSpinBox;
 
 namespace Engine::Network
 {
@@ -23,5 +23,8 @@ public:
 
 protected:
   QLineEdit* m_deviceNameEdit{};
+  QLineEdit* m_host{};
+  QSpinBox* m_universes{};
+  QSpinBox* m_rate{};
 };
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <QMetaType>
+#include <QString>
 
 #include <wobjectdefs.h>
 
@@ -9,7 +10,14 @@ namespace Engine::Network
 
 struct ArtnetSpecificSettings
 {
-  int dummy;
+  //! Where the ArtDMX packets are sent, the Art-Net broadcast by default
+  QString host{"2.255.255.255"};
+
+  //! Number of universes, starting at universe 0
+  int universes{1};
+
+  //! Maximal number of packets per second and per universe
+  int rate{20};
 };
 }
 
@@ -7,24 +7,42 @@
 #include <QJsonValue>
 #include <QString>
 
+// Devices saved before these settings existed only have the delimiter:
+// the version is written first so that it can be told from it.
+static constexpr int32_t artnet_settings_version = 1;
+
 template <>
 void DataStreamReader::read(const Engine::Network::ArtnetSpecificSettings& n)
 {
+  m_stream << artnet_settings_version << n.host << n.universes << n.rate;
   insertDelimiter();
 }
 
 template <>
 void DataStreamWriter::write(Engine::Network::ArtnetSpecificSettings& n)
 {
+  int32_t version{};
+  m_stream >> version;
+  if (version == int32_t(0xDEADBEEF))
+    return;
+
+  m_stream >> n.host >> n.universes >> n.rate;
   checkDelimiter();
 }
 
 template <>
 void JSONObjectReader::read(const Engine::Network::ArtnetSpecificSettings& n)
 {
+  obj["Host"] = n.host;
+  obj["Universes"] = n.universes;
+  obj["Rate"] = n.rate;
 }
 
 template <>
 void JSONObjectWriter::write(Engine::Network::ArtnetSpecificSettings& n)
 {
+  // Devices saved before these settings existed keep the defaults
+  n.host = obj["Host"].toString(n.host);
+  n.universes = obj["Universes"].toInt(n.universes);
+  n.rate = obj["Rate"].toInt(n.rate);
 }
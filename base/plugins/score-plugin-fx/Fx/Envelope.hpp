@@ -1,5 +1,6 @@
 #pragma once
 #include <Engine/Node/PdNode.hpp>
+#include <Fx/Kernels.hpp>
 
 #include <numeric>
 namespace Nodes
@@ -25,26 +26,31 @@ struct Node
     static const constexpr value_out value_outs[]{"rms", "peak"};
   };
 
+  struct State
+  {
+    State()
+    {
+      rms.reserve(16);
+      peak.reserve(16);
+    }
+
+    // Values of each channel, reused across ticks
+    std::vector<ossia::value> rms;
+    std::vector<ossia::value> peak;
+  };
+
   using control_policy = ossia::safe_nodes::default_tick;
   static auto get(const ossia::audio_channel& chan)
   {
+    using val_t = ossia::audio_channel::value_type;
     if (chan.size() > 0)
     {
-      auto max = chan[0];
-      auto rms = 0.;
-      for (auto sample : chan)
-      {
-        max = std::max(max, std::abs(sample));
-        rms += sample * sample;
-      }
-      rms = std::sqrt(rms);
-      rms /= chan.size();
-
-      return std::make_pair(rms, max);
+      const auto env = Kernels::envelope(chan.data(), chan.size());
+      const val_t rms = std::sqrt(env.sum_squares) / chan.size();
+      return std::make_pair(rms, val_t(env.peak));
     }
     else
     {
-      using val_t = ossia::audio_channel::value_type;
       return std::make_pair(val_t{}, val_t{});
     }
   }
@@ -52,9 +58,10 @@ struct Node
   static void
   run(const ossia::audio_port& audio, ossia::value_port& rms_port,
       ossia::value_port& peak_port, ossia::token_request tk,
-      ossia::exec_state_facade)
+      ossia::exec_state_facade, State& self)
   {
-    switch (audio.samples.size())
+    const std::size_t channels = audio.samples.size();
+    switch (channels)
     {
       case 0:
         return;
@@ -68,18 +75,17 @@ struct Node
       }
       default:
       {
-        std::vector<ossia::value> peak_vec;
-        peak_vec.reserve(audio.samples.size());
-        std::vector<ossia::value> rms_vec;
-        rms_vec.reserve(audio.samples.size());
-        for (auto& c : audio.samples)
+        // Only reallocates if there are more channels than ever before
+        self.rms.resize(channels);
+        self.peak.resize(channels);
+        for (std::size_t i = 0; i < channels; i++)
         {
-          auto [rms, peak] = get(c);
-          rms_vec.push_back(rms);
-          peak_vec.push_back(peak);
+          auto [rms, peak] = get(audio.samples[i]);
+          self.rms[i] = rms;
+          self.peak[i] = peak;
         }
-        rms_port.write_value(rms_vec, tk.tick_start());
-        peak_port.write_value(peak_vec, tk.tick_start());
+        rms_port.write_value(self.rms, tk.tick_start());
+        peak_port.write_value(self.peak, tk.tick_start());
       }
       break;
     }
@@ -1,8 +1,6 @@
 #pragma once
 #include <Engine/Node/PdNode.hpp>
-#if defined(__AVX2__) && __has_include(<immintrin.h>)
-#include <immintrin.h>
-#endif
+#include <Fx/Ramp.hpp>
 namespace Nodes::Gain
 {
 struct Node
@@ -25,13 +23,31 @@ struct Node
     static const constexpr audio_out audio_outs[]{"out"};
   };
 
-  using control_policy = ossia::safe_nodes::last_tick;
+  struct State
+  {
+    // Gain reached at the end of the previous tick
+    double gain{};
+    bool first{true};
+  };
+
+  // All the values received during the tick are used, so that a gain
+  // automated with a large buffer size gives a sample-accurate envelope.
+  using control_policy = ossia::safe_nodes::default_tick;
   static void
-  run(const ossia::audio_port& p1, float g, ossia::audio_port& p2,
-      ossia::token_request, ossia::exec_state_facade)
+  run(const ossia::audio_port& p1,
+      const ossia::safe_nodes::timed_vec<float>& g, ossia::audio_port& p2,
+      ossia::token_request, ossia::exec_state_facade, State& self)
   {
+    if (self.first)
+    {
+      self.gain = g.begin()->second;
+      self.first = false;
+    }
+
     const auto chans = p1.samples.size();
     p2.samples.resize(chans);
+
+    double end = self.gain;
     for (std::size_t i = 0; i < chans; i++)
     {
       auto& in = p1.samples[i];
@@ -40,27 +56,13 @@ struct Node
       const auto samples = in.size();
       out.resize(samples);
 
-      std::size_t j = 0;
-
-#if defined(__AVX2__) && __has_include(<immintrin.h>)
-      if (samples > 4)
-      {
-        const auto gain = _mm256_set1_pd(g);
-        for (; j < samples - 4; j += 4)
-        {
-          _mm256_store_pd(
-              &out[j], _mm256_mul_pd(_mm256_load_pd(&in[j]), gain));
-        }
-      }
-#endif
-
-      {
-        for (; j < samples; j++)
-        {
-          out[j] = in[j] * g;
-        }
-      }
+      end = apply_ramp(g, self.gain, in.data(), out.data(), samples);
     }
+
+    if (chans > 0)
+      self.gain = end;
+    else
+      self.gain = g.rbegin()->second;
   }
 };
 }
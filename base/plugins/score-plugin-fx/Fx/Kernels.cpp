@@ -0,0 +1,263 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include "Kernels.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__) \
+    && __has_include(<immintrin.h>)
+#define SCORE_FX_KERNELS_X86 1
+#include <immintrin.h>
+#endif
+
+namespace Nodes::Kernels
+{
+namespace
+{
+using kernel_table = implementation_t;
+
+// Scalar versions, also used for the tail of the vectorized loops
+void gain_scalar(const double* in, double* out, std::size_t n, double g)
+{
+  for (std::size_t i = 0; i < n; i++)
+    out[i] = in[i] * g;
+}
+
+void ramp_scalar(
+    const double* in, double* out, std::size_t n, double g0, double step)
+{
+  for (std::size_t i = 0; i < n; i++)
+    out[i] = in[i] * (g0 + step * i);
+}
+
+envelope_t envelope_scalar(const double* in, std::size_t n)
+{
+  envelope_t res;
+  for (std::size_t i = 0; i < n; i++)
+  {
+    res.peak = std::max(res.peak, std::abs(in[i]));
+    res.sum_squares += in[i] * in[i];
+  }
+  return res;
+}
+
+void ramp_generic(
+    const double* in, double* out, std::size_t n, double g0, double g1)
+{
+  ramp_scalar(in, out, n, g0, (g1 - g0) / n);
+}
+
+#if defined(SCORE_FX_KERNELS_X86)
+// SSE2
+__attribute__((target("sse2"))) void
+gain_sse2(const double* in, double* out, std::size_t n, double g)
+{
+  const __m128d gain = _mm_set1_pd(g);
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+    _mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(in + i), gain));
+  gain_scalar(in + i, out + i, n - i, g);
+}
+
+__attribute__((target("sse2"))) void ramp_sse2(
+    const double* in, double* out, std::size_t n, double g0, double g1)
+{
+  const double step = (g1 - g0) / n;
+  __m128d gain = _mm_set_pd(g0 + step, g0);
+  const __m128d inc = _mm_set1_pd(2. * step);
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    _mm_storeu_pd(out + i, _mm_mul_pd(_mm_loadu_pd(in + i), gain));
+    gain = _mm_add_pd(gain, inc);
+  }
+  ramp_scalar(in + i, out + i, n - i, g0 + step * i, step);
+}
+
+__attribute__((target("sse2"))) envelope_t
+envelope_sse2(const double* in, std::size_t n)
+{
+  const __m128d sign = _mm_set1_pd(-0.);
+  __m128d peak = _mm_setzero_pd();
+  __m128d sum = _mm_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2)
+  {
+    const __m128d x = _mm_loadu_pd(in + i);
+    peak = _mm_max_pd(peak, _mm_andnot_pd(sign, x));
+    sum = _mm_add_pd(sum, _mm_mul_pd(x, x));
+  }
+
+  alignas(16) double p[2], s[2];
+  _mm_store_pd(p, peak);
+  _mm_store_pd(s, sum);
+
+  envelope_t res = envelope_scalar(in + i, n - i);
+  res.peak = std::max({res.peak, p[0], p[1]});
+  res.sum_squares += s[0] + s[1];
+  return res;
+}
+
+// AVX2
+__attribute__((target("avx2"))) void
+gain_avx2(const double* in, double* out, std::size_t n, double g)
+{
+  const __m256d gain = _mm256_set1_pd(g);
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+    _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(in + i), gain));
+  gain_scalar(in + i, out + i, n - i, g);
+}
+
+__attribute__((target("avx2"))) void ramp_avx2(
+    const double* in, double* out, std::size_t n, double g0, double g1)
+{
+  const double step = (g1 - g0) / n;
+  __m256d gain
+      = _mm256_set_pd(g0 + 3. * step, g0 + 2. * step, g0 + step, g0);
+  const __m256d inc = _mm256_set1_pd(4. * step);
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_loadu_pd(in + i), gain));
+    gain = _mm256_add_pd(gain, inc);
+  }
+  ramp_scalar(in + i, out + i, n - i, g0 + step * i, step);
+}
+
+__attribute__((target("avx2,fma"))) envelope_t
+envelope_avx2(const double* in, std::size_t n)
+{
+  const __m256d sign = _mm256_set1_pd(-0.);
+  __m256d peak = _mm256_setzero_pd();
+  __m256d sum = _mm256_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4)
+  {
+    const __m256d x = _mm256_loadu_pd(in + i);
+    peak = _mm256_max_pd(peak, _mm256_andnot_pd(sign, x));
+    sum = _mm256_fmadd_pd(x, x, sum);
+  }
+
+  alignas(32) double p[4], s[4];
+  _mm256_store_pd(p, peak);
+  _mm256_store_pd(s, sum);
+
+  envelope_t res = envelope_scalar(in + i, n - i);
+  res.peak = std::max({res.peak, p[0], p[1], p[2], p[3]});
+  res.sum_squares += (s[0] + s[1]) + (s[2] + s[3]);
+  return res;
+}
+
+// AVX-512
+__attribute__((target("avx512f"))) void
+gain_avx512(const double* in, double* out, std::size_t n, double g)
+{
+  const __m512d gain = _mm512_set1_pd(g);
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+    _mm512_storeu_pd(out + i, _mm512_mul_pd(_mm512_loadu_pd(in + i), gain));
+  gain_scalar(in + i, out + i, n - i, g);
+}
+
+__attribute__((target("avx512f"))) void ramp_avx512(
+    const double* in, double* out, std::size_t n, double g0, double g1)
+{
+  const double step = (g1 - g0) / n;
+  __m512d gain = _mm512_fmadd_pd(
+      _mm512_set_pd(7., 6., 5., 4., 3., 2., 1., 0.), _mm512_set1_pd(step),
+      _mm512_set1_pd(g0));
+  const __m512d inc = _mm512_set1_pd(8. * step);
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    _mm512_storeu_pd(out + i, _mm512_mul_pd(_mm512_loadu_pd(in + i), gain));
+    gain = _mm512_add_pd(gain, inc);
+  }
+  ramp_scalar(in + i, out + i, n - i, g0 + step * i, step);
+}
+
+__attribute__((target("avx512f"))) envelope_t
+envelope_avx512(const double* in, std::size_t n)
+{
+  __m512d peak = _mm512_setzero_pd();
+  __m512d sum = _mm512_setzero_pd();
+  std::size_t i = 0;
+  for (; i + 8 <= n; i += 8)
+  {
+    const __m512d x = _mm512_loadu_pd(in + i);
+    peak = _mm512_max_pd(peak, _mm512_abs_pd(x));
+    sum = _mm512_fmadd_pd(x, x, sum);
+  }
+
+  alignas(64) double p[8], s[8];
+  _mm512_store_pd(p, peak);
+  _mm512_store_pd(s, sum);
+
+  envelope_t res = envelope_scalar(in + i, n - i);
+  res.peak = std::max(res.peak, *std::max_element(p, p + 8));
+  res.sum_squares += ((s[0] + s[1]) + (s[2] + s[3]))
+                     + ((s[4] + s[5]) + (s[6] + s[7]));
+  return res;
+}
+#endif
+
+// From the least to the most specific
+std::vector<kernel_table> supported_kernels()
+{
+  std::vector<kernel_table> res{
+      {"scalar", gain_scalar, ramp_generic, envelope_scalar}};
+#if defined(SCORE_FX_KERNELS_X86)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse2"))
+    res.push_back({"sse2", gain_sse2, ramp_sse2, envelope_sse2});
+  if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma"))
+    res.push_back({"avx2", gain_avx2, ramp_avx2, envelope_avx2});
+  if (__builtin_cpu_supports("avx512f"))
+    res.push_back({"avx512", gain_avx512, ramp_avx512, envelope_avx512});
+#endif
+  return res;
+}
+
+kernel_table select_kernels()
+{
+  return supported_kernels().back();
+}
+
+const kernel_table& kernels() noexcept
+{
+  static const kernel_table table = select_kernels();
+  return table;
+}
+}
+
+void gain(const double* in, double* out, std::size_t n, double g) noexcept
+{
+  kernels().gain(in, out, n, g);
+}
+
+void ramp(
+    const double* in, double* out, std::size_t n, double g0,
+    double g1) noexcept
+{
+  if (n > 0)
+    kernels().ramp(in, out, n, g0, g1);
+}
+
+envelope_t envelope(const double* in, std::size_t n) noexcept
+{
+  return kernels().envelope(in, n);
+}
+
+const char* implementation() noexcept
+{
+  return kernels().name;
+}
+
+std::vector<implementation_t> implementations()
+{
+  return supported_kernels();
+}
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <cstddef>
+#include <vector>
+
+#include <score_plugin_fx_export.h>
+
+/**
+ * Audio processing kernels shared by the nodes of this plugin.
+ *
+ * The best implementation for the CPU is chosen at run-time (AVX-512, AVX2,
+ * SSE2 or scalar), so that builds targeting a generic x86-64 still get
+ * vectorized loops on recent processors.
+ */
+namespace Nodes::Kernels
+{
+struct envelope_t
+{
+  double peak{};
+  double sum_squares{};
+};
+
+//! out[i] = in[i] * g
+SCORE_PLUGIN_FX_EXPORT
+void gain(const double* in, double* out, std::size_t n, double g) noexcept;
+
+//! out[i] = in[i] * (g0 + (g1 - g0) * i / n)
+SCORE_PLUGIN_FX_EXPORT
+void ramp(
+    const double* in, double* out, std::size_t n, double g0,
+    double g1) noexcept;
+
+//! Maximum of |in[i]| and sum of in[i]^2
+SCORE_PLUGIN_FX_EXPORT
+envelope_t envelope(const double* in, std::size_t n) noexcept;
+
+//! Name of the implementation in use, for debugging purposes.
+SCORE_PLUGIN_FX_EXPORT
+const char* implementation() noexcept;
+
+//! A set of kernels for a given instruction set.
+//! ramp expects n > 0.
+struct implementation_t
+{
+  const char* name;
+  void (*gain)(const double*, double*, std::size_t, double);
+  void (*ramp)(const double*, double*, std::size_t, double, double);
+  envelope_t (*envelope)(const double*, std::size_t);
+};
+
+//! The implementations supported by this CPU, the scalar one first,
+//! so that they can be checked against each other.
+SCORE_PLUGIN_FX_EXPORT
+std::vector<implementation_t> implementations();
+}
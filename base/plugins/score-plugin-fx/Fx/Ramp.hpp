@@ -0,0 +1,70 @@
+#pragma once
+#include <ossia/dataflow/safe_nodes/tick_policies.hpp>
+
+#include <Fx/Kernels.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace Nodes
+{
+/**
+ * @brief Applies a control which changes during a buffer as a gain
+ *
+ * Each value of the control is reached linearly, at the time of the next
+ * value or at the end of the buffer, starting from the value reached at the
+ * end of the previous buffer. Hence a single value per tick gives a ramp
+ * over the buffer, and values received at several times in the buffer give
+ * a sample-accurate piecewise-linear envelope, with no discontinuity
+ * whatever the buffer size.
+ *
+ * The values are given by the default_tick policy of the node, keyed by
+ * their position in the buffer.
+ *
+ * @return the value reached at the end of the buffer.
+ */
+template <typename T>
+double apply_ramp(
+    const ossia::safe_nodes::timed_vec<T>& values, double current,
+    const double* in, double* out, std::size_t n) noexcept
+{
+  const auto to_pos = [n](int64_t t) {
+    return std::size_t(std::clamp(t, int64_t(0), int64_t(n)));
+  };
+
+  auto segment = [&](std::size_t& pos, std::size_t end, double target) {
+    if (target == current)
+      Kernels::gain(in + pos, out + pos, end - pos, current);
+    else
+      Kernels::ramp(in + pos, out + pos, end - pos, current, target);
+    pos = end;
+  };
+
+  std::size_t pos = 0;
+  for (auto it = values.begin(); it != values.end(); ++it)
+  {
+    // Keep the current value until the first change
+    const std::size_t start = to_pos(it->first);
+    if (start > pos)
+      segment(pos, start, current);
+
+    const auto next = std::next(it);
+    const std::size_t end = next == values.end() ? n : to_pos(next->first);
+    if (end > pos)
+    {
+      segment(pos, end, it->second);
+      current = it->second;
+    }
+    else if (next == values.end())
+    {
+      // Received at the very end of the buffer
+      current = it->second;
+    }
+  }
+
+  if (pos < n)
+    segment(pos, n, current);
+
+  return current;
+}
+}
@@ -0,0 +1,104 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <Fx/Kernels.hpp>
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <vector>
+
+class KernelsTest : public QObject
+{
+  Q_OBJECT
+
+  using Kernels = Nodes::Kernels::implementation_t;
+
+  static std::vector<double> signal(std::size_t n)
+  {
+    std::mt19937 gen{1234};
+    std::uniform_real_distribution<double> dist{-1., 1.};
+    std::vector<double> vec(n);
+    for (auto& v : vec)
+      v = dist(gen);
+    return vec;
+  }
+
+  static bool close(double a, double b)
+  {
+    return std::abs(a - b) <= 1e-12 * std::max(1., std::abs(b));
+  }
+
+private Q_SLOTS:
+  // Every size up to a few vectors of the widest instruction set, so that
+  // the vectorized loops and their scalar tails are both covered.
+  void test_same_results()
+  {
+    const auto impls = Nodes::Kernels::implementations();
+    QVERIFY(!impls.empty());
+    QCOMPARE(QString{impls.front().name}, QString{"scalar"});
+    const Kernels& ref = impls.front();
+
+    for (const Kernels& impl : impls)
+    {
+      for (std::size_t n = 1; n <= 67; n++)
+      {
+        const auto in = signal(n);
+        std::vector<double> expected(n), actual(n);
+
+        ref.gain(in.data(), expected.data(), n, 0.7);
+        impl.gain(in.data(), actual.data(), n, 0.7);
+        for (std::size_t i = 0; i < n; i++)
+          QVERIFY2(close(actual[i], expected[i]), impl.name);
+
+        ref.ramp(in.data(), expected.data(), n, 0.2, 0.9);
+        impl.ramp(in.data(), actual.data(), n, 0.2, 0.9);
+        for (std::size_t i = 0; i < n; i++)
+          QVERIFY2(close(actual[i], expected[i]), impl.name);
+
+        const auto env_expected = ref.envelope(in.data(), n);
+        const auto env_actual = impl.envelope(in.data(), n);
+        QVERIFY2(env_actual.peak == env_expected.peak, impl.name);
+        QVERIFY2(
+            close(env_actual.sum_squares, env_expected.sum_squares),
+            impl.name);
+      }
+
+      const auto env = impl.envelope(nullptr, 0);
+      QCOMPARE(env.peak, 0.);
+      QCOMPARE(env.sum_squares, 0.);
+    }
+  }
+
+  // Time taken by each implementation for a buffer of 512 samples
+  void test_speed()
+  {
+    using clock = std::chrono::steady_clock;
+    constexpr std::size_t n = 512;
+    constexpr int iterations = 100000;
+    const auto in = signal(n);
+    std::vector<double> out(n);
+
+    for (const Kernels& impl : Nodes::Kernels::implementations())
+    {
+      double sink = 0.;
+      const auto t0 = clock::now();
+      for (int i = 0; i < iterations; i++)
+      {
+        impl.ramp(in.data(), out.data(), n, 0.2, 0.9);
+        sink += impl.envelope(out.data(), n).sum_squares;
+      }
+      const auto t1 = clock::now();
+      QVERIFY(std::isfinite(sink));
+      qDebug() << impl.name << ":"
+               << std::chrono::duration<double, std::nano>(t1 - t0).count()
+                      / iterations
+               << "ns per buffer";
+    }
+  }
+};
+
+QTEST_APPLESS_MAIN(KernelsTest)
+#include "KernelsTest.moc"
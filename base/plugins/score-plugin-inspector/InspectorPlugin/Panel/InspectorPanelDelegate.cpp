@@ -58,7 +58,8 @@ void PanelDelegate::on_modelChanged(
   }
 }
 
-void PanelDelegate::setNewSelection(const Selection& s)
+void PanelDelegate::setNewSelection(
+    const Selection& s, const SelectionDelta& delta)
 {
   if (m_inspectorPanel)
     m_inspectorPanel->newItemsInspected(s);
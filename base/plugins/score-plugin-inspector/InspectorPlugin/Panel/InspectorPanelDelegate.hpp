@@ -18,7 +18,8 @@ private:
 
   void on_modelChanged(
       score::MaybeDocument oldm, score::MaybeDocument newm) override;
-  void setNewSelection(const Selection& s) override;
+  void
+  setNewSelection(const Selection& s, const SelectionDelta& delta) override;
 
   QWidget* m_widget{};
   InspectorPanelWidget* m_inspectorPanel{};
@@ -115,7 +115,7 @@ Selection ProcessModel::selectedChildren() const noexcept
 void ProcessModel::setSelection(const Selection& s) const noexcept
 {
   ossia::for_each_in_tuple(elements(), [&](auto elt) {
-    elt->selection.set(s.contains(elt)); // OPTIMIZEME
+    elt->selection.update(s.contains(elt));
   });
 }
 
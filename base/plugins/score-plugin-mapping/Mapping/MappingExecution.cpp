@@ -107,7 +107,7 @@ std::shared_ptr<ossia::curve_abstract> Component::on_curveChanged_impl2()
   auto scale_x = [=](double val) -> X_T { return val * (xmax - xmin) + xmin; };
   auto scale_y = [=](double val) -> Y_T { return val * (ymax - ymin) + ymin; };
 
-  auto segt_data = process().curve().sortedSegments();
+  const auto& segt_data = process().curve().sortedSegments();
   if (segt_data.size() != 0)
   {
     return Engine::score_to_ossia::curve<X_T, Y_T>(
@@ -1,6 +1,9 @@
 #include "ApplicationPlugin.hpp"
 
 #include <Media/Effect/Settings/Model.hpp>
+#if defined(HAS_FAUST)
+#include <Media/Effect/Faust/FaustFactoryCache.hpp>
+#endif
 #if defined(LILV_SHARED)
 #include <Media/Effect/LV2/LV2Context.hpp>
 #include <Media/Effect/LV2/LV2EffectModel.hpp>
@@ -112,6 +115,9 @@ ApplicationPlugin::ApplicationPlugin(const score::ApplicationContext& app)
 }
 #endif
 {
+#if defined(HAS_FAUST)
+  faust_compiler = std::make_unique<Faust::FactoryCompiler>();
+#endif
 
 #if defined(HAS_VST2)
   qRegisterMetaType<vst_info>();
@@ -17,6 +17,7 @@
 
 #include <QProcess>
 
+#include <memory>
 #include <thread>
 namespace Media
 {
@@ -25,6 +26,10 @@ namespace LV2
 struct HostContext;
 struct GlobalContext;
 }
+namespace Faust
+{
+class FactoryCompiler;
+}
 class ApplicationPlugin : public QObject, public score::ApplicationPlugin
 {
   W_OBJECT(ApplicationPlugin)
@@ -41,6 +46,11 @@ public:
   LV2::HostContext lv2_host_context;
 #endif
 
+#if defined(HAS_FAUST)
+public:
+  std::unique_ptr<Faust::FactoryCompiler> faust_compiler;
+#endif
+
 #if defined(HAS_VST2)
 public:
   void rescanVSTs(const QStringList&);
@@ -18,7 +18,6 @@ extern "C"
 #include <libavformat/avformat.h>
 #include <libavutil/frame.h>
 #include <libavutil/mem.h>
-#include <libswresample/swresample.h>
 }
 #endif
 
@@ -447,15 +446,6 @@ ossia::optional<AudioInfo> AudioDecoder::probe(const QString& path)
         info.length = read_length(path);
         info.max_arr_length = info.length;
 
-        if (info.rate != 44100)
-        {
-          info.length
-              = av_rescale_rnd(info.length, 44100, info.rate, AV_ROUND_UP);
-
-          if (info.length > info.max_arr_length)
-            info.max_arr_length = info.length;
-        }
-
         database().insert(path, info);
         return info;
       }
@@ -659,72 +649,19 @@ template <typename Decoder>
 void AudioDecoder::decodeFrame(Decoder dec, audio_array& data, AVFrame& frame)
 {
 #if __has_include(<libavcodec/avcodec.h>)
-  const std::size_t channels = data.size();
+  // The file is kept at its own sample rate: see Sound::sound_node
   const std::size_t max_samples = data[0].size();
-
-  if (sampleRate != 44100)
+  if (decoded + frame.nb_samples > max_samples)
   {
-    auto new_len
-        = av_rescale_rnd(frame.nb_samples, 44100, sampleRate, AV_ROUND_UP);
-
-    if (decoded + new_len > max_samples)
-    {
-      qDebug() << "ERROR" << decoded + frame.nb_samples << ">" << max_samples;
-      return;
-    }
-
-    audio_array tmp;
-    tmp.resize(channels);
-    for (auto& sub : tmp)
-      sub.resize(frame.nb_samples * 2);
-
-    dec(tmp, 0, frame.extended_data, frame.nb_samples);
-
-    int res = 0;
-    for (std::size_t i = 0; i < channels; ++i)
-    {
-      audio_sample* out_ptr = data[i].data() + decoded;
-      audio_sample* in_ptr = tmp[i].data();
-
-      res = swr_convert(
-          resampler[i], (uint8_t**)&out_ptr, new_len, (const uint8_t**)&in_ptr,
-          frame.nb_samples);
-    }
-    decoded += res;
+    qDebug() << "ERROR" << decoded + frame.nb_samples << ">" << max_samples;
+    return;
   }
-  else
-  {
-    if (decoded + frame.nb_samples > max_samples)
-    {
-      qDebug() << "ERROR" << decoded + frame.nb_samples << ">" << max_samples;
-      return;
-    }
 
-    dec(data, decoded, frame.extended_data, frame.nb_samples);
-    decoded += frame.nb_samples;
-  }
+  dec(data, decoded, frame.extended_data, frame.nb_samples);
+  decoded += frame.nb_samples;
 #endif
 }
 
-void AudioDecoder::decodeRemaining(audio_array& data)
-{
-#if __has_include(<libavcodec/avcodec.h>)
-  const std::size_t channels = data.size();
-  if (sampleRate != 44100)
-  {
-    int res = 0;
-    for (std::size_t i = 0; i < channels; ++i)
-    {
-      audio_sample* out_ptr = data[i].data() + decoded;
-
-      res = swr_convert(
-          resampler[i], (uint8_t**)&out_ptr, data[i].size() - decoded, nullptr,
-          0);
-    }
-    decoded += res;
-  }
-#endif
-}
 void AudioDecoder::on_startDecode(QString path, audio_handle hdl)
 {
 #if __has_include(<libavcodec/avcodec.h>)
@@ -732,8 +669,6 @@ void AudioDecoder::on_startDecode(QString path, audio_handle hdl)
   auto& data = hdl->data;
   try
   {
-    const std::size_t channels = data.size();
-
     av_register_all();
     avcodec_register_all();
 
@@ -777,19 +712,6 @@ void AudioDecoder::on_startDecode(QString path, audio_handle hdl)
     if (!decoder)
       throw std::runtime_error("Couldn't create decoder");
 
-    // init resampling
-    if (sampleRate != 44100)
-    {
-      for (std::size_t i = 0; i < channels; ++i)
-      {
-        SwrContext* swr = swr_alloc_set_opts(
-            nullptr, AV_CH_LAYOUT_MONO, AV_SAMPLE_FMT_DBL, 44100,
-            AV_CH_LAYOUT_MONO, AV_SAMPLE_FMT_DBL, sampleRate, 0, nullptr);
-        swr_init(swr);
-        resampler.push_back(swr);
-      }
-    }
-
     // decoding
     eggs::variants::apply(
         [&](auto& dec) {
@@ -855,15 +777,8 @@ void AudioDecoder::on_startDecode(QString path, audio_handle hdl)
 
           // Flush
           avcodec_send_packet(codec_ctx.get(), nullptr);
-
-          decodeRemaining(data);
         },
         decoder);
-
-    // clear resampling
-    for (auto swr : resampler)
-      swr_free(&swr);
-    resampler.clear();
   }
   catch (std::exception& e)
   {
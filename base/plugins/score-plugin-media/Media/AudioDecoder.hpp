@@ -10,7 +10,6 @@
 #include <atomic>
 #include <vector>
 struct AVFrame;
-struct SwrContext;
 
 namespace Media
 {
@@ -63,9 +62,6 @@ private:
 
   template <typename Decoder>
   void decodeFrame(Decoder dec, audio_array& data, AVFrame& frame);
-  void decodeRemaining(audio_array& data);
-  std::vector<SwrContext*> resampler;
-  void initResample();
 };
 }
 
@@ -309,6 +309,6 @@ void Media::Effect::ProcessModel::setSelection(const Selection& s) const noexcep
 {
   for (auto& c : effects())
   {
-    c.selection.set(s.contains(&c));
+    c.selection.update(s.contains(&c));
   }
 }
@@ -1,15 +1,21 @@
 #if defined(HAS_FAUST)
 #include "FaustEffectModel.hpp"
 
+#include <Media/ApplicationPlugin.hpp>
 #include <Media/Commands/EditFaustEffect.hpp>
+#include <Media/Effect/Faust/FaustFactoryCache.hpp>
 #include <Media/Effect/Faust/FaustUtils.hpp>
+#include <Process/Dataflow/Cable.hpp>
 #include <Process/Dataflow/PortFactory.hpp>
 #include <Process/ExecutionContext.hpp>
+#include <Process/ExecutionSetup.hpp>
 
+#include <score/application/ApplicationComponents.hpp>
 #include <score/command/Dispatchers/CommandDispatcher.hpp>
 #include <score/tools/IdentifierGeneration.hpp>
 
 #include <ossia/dataflow/execution_state.hpp>
+#include <ossia/dataflow/graph/graph_interface.hpp>
 #include <ossia/dataflow/nodes/faust/faust_node.hpp>
 
 #include <QDialog>
@@ -91,94 +97,35 @@ void FaustEffectModel::reload()
     return;
   }
 
-  char err[4096] = {};
-
-  const char* triple =
-#if defined(_MSC_VER)
-      "x86_64-pc-windows-msvc"
-#else
-      ""
-#endif
-      ;
-  auto str = fx_text.toStdString();
-  int argc = 0;
-  const char* argv[1]{};
-
-  auto fac = createCDSPFactoryFromString(
-      "score", str.c_str(), argc, argv, triple, err, -1);
-
-  if (err[0] != 0)
-    qDebug() << "Faust error: " << err;
-  if (!fac)
-  {
-    // TODO mark as invalid, like JS
-    return;
-  }
-
-  auto obj = createCDSPInstance(fac);
-  if (!obj)
-    return;
-
-  if (faust_factory && faust_object)
-  {
-    // updating an existing DSP
-
-    deleteCDSPInstance(faust_object); // TODO not thread-safe wrt exec thread
-    deleteCDSPFactory(faust_factory);
-
-    faust_factory = fac;
-    faust_object = obj;
-    // Try to reuse controls
-    Faust::UpdateUI<decltype(*this)> ui{*this};
-    buildUserInterfaceCDSPInstance(faust_object, &ui.glue);
-
-    for (std::size_t i = ui.i; i < m_inlets.size(); i++)
-    {
-      controlRemoved(*m_inlets[i]);
-      delete m_inlets[i];
-    }
-    m_inlets.resize(ui.i);
-  }
-  else if (
-      !m_inlets.empty() && !m_outlets.empty() && !faust_factory
-      && !faust_object)
+  // The audio ports do not depend on the program
+  if (m_inlets.empty())
   {
-    // loading
-
-    faust_factory = fac;
-    faust_object = obj;
-    // Try to reuse controls
-    Faust::UpdateUI<decltype(*this)> ui{*this};
-    buildUserInterfaceCDSPInstance(faust_object, &ui.glue);
-  }
-  else
-  {
-    // creating a new dsp
-
-    if (faust_factory)
-      deleteCDSPFactory(faust_factory);
-
-    faust_factory = fac;
-    faust_object = obj;
-    for (std::size_t i = 1; i < m_inlets.size(); i++)
-    {
-      controlRemoved(*m_inlets[i]);
-    }
-    qDeleteAll(m_inlets);
-    qDeleteAll(m_outlets);
-    m_inlets.clear();
-    m_outlets.clear();
-
     m_inlets.push_back(new Process::Inlet{getStrongId(m_inlets), this});
     m_inlets.back()->type = Process::PortType::Audio;
+  }
+  if (m_outlets.empty())
+  {
     m_outlets.push_back(new Process::Outlet{getStrongId(m_outlets), this});
     m_outlets.back()->type = Process::PortType::Audio;
     m_outlets.back()->setPropagate(true);
-
-    Faust::UI<decltype(*this)> ui{*this};
-    buildUserInterfaceCDSPInstance(faust_object, &ui.glue);
   }
 
+  // The controls are created once the program is compiled; until then
+  // the effect stays silent.
+  auto& compiler = *score::AppComponents()
+                        .applicationPlugin<Media::ApplicationPlugin>()
+                        .faust_compiler;
+  compiler.compile(this, fx_text, [this, fx_text](llvm_dsp_factory* fac) {
+    // The text was changed again while compiling
+    if (fx_text != m_text.toLocal8Bit())
+    {
+      if (fac)
+        deleteCDSPFactory(fac);
+      return;
+    }
+    setFactory(fac);
+  });
+
   auto lines = fx_text.split('\n');
   for (int i = 0; i < std::min(5, lines.size()); i++)
   {
@@ -199,6 +146,41 @@ void FaustEffectModel::reload()
   }
 }
 
+void FaustEffectModel::setFactory(llvm_dsp_factory* fac)
+{
+  if (!fac)
+  {
+    // TODO mark as invalid, like JS
+    return;
+  }
+
+  auto obj = createCDSPInstance(fac);
+  if (!obj)
+  {
+    deleteCDSPFactory(fac);
+    return;
+  }
+
+  // The previous instance, if any, is freed once neither the model nor the
+  // execution refer to it anymore.
+  std::shared_ptr<llvm_dsp_factory> factory{fac, deleteCDSPFactory};
+  faust_object = std::shared_ptr<llvm_dsp>{
+      obj, [factory](llvm_dsp* obj) { deleteCDSPInstance(obj); }};
+
+  // Try to reuse controls, e.g. the ones loaded with the document
+  Faust::UpdateUI<decltype(*this)> ui{*this};
+  buildUserInterfaceCDSPInstance(faust_object.get(), &ui.glue);
+
+  for (std::size_t i = ui.i; i < m_inlets.size(); i++)
+  {
+    controlRemoved(*m_inlets[i]);
+    delete m_inlets[i];
+  }
+  m_inlets.resize(ui.i);
+
+  dspChanged();
+}
+
 InspectorWidget::InspectorWidget(
     const Media::Faust::FaustEffectModel& fx,
     const score::DocumentContext& doc, QWidget* parent)
@@ -282,32 +264,136 @@ void JSONObjectWriter::write(Media::Faust::FaustEffectModel& eff)
 namespace Execution
 {
 
+namespace
+{
+//! Stands for the effect until its program is compiled
+class faust_placeholder_node final : public ossia::graph_node
+{
+public:
+  explicit faust_placeholder_node(std::size_t controls)
+  {
+    m_inlets.push_back(ossia::make_inlet<ossia::audio_port>());
+    for (std::size_t i = 0; i < controls; i++)
+      m_inlets.push_back(ossia::make_inlet<ossia::value_port>());
+    m_outlets.push_back(ossia::make_outlet<ossia::audio_port>());
+  }
+
+  void
+  run(ossia::token_request, ossia::exec_state_facade) noexcept override
+  {
+  }
+
+  std::string label() const noexcept override
+  {
+    return "Faust";
+  }
+};
+}
+
 Execution::FaustEffectComponent::FaustEffectComponent(
     Media::Faust::FaustEffectModel& proc, const Execution::Context& ctx,
     const Id<score::Component>& id, QObject* parent)
     : ProcessComponent_T{proc, ctx, id, "FaustComponent", parent}
 {
-  if (proc.faust_object)
+  // Compilation is asynchronous: the node is replaced once the program is
+  // compiled, even if the execution has already started.
+  this->node = createNode();
+  m_ossia_process = std::make_shared<ossia::node_process>(this->node);
+  m_registeredInlets = proc.inlets();
+  m_registeredOutlets = proc.outlets();
+
+  connect(
+      &proc, &Media::Faust::FaustEffectModel::dspChanged, this,
+      &FaustEffectComponent::reloadNode);
+}
+
+Execution::FaustEffectComponent::~FaustEffectComponent()
+{
+  // The node may still run until the execution removes it
+  if (m_dsp)
+    in_exec([dsp = std::move(m_dsp)] {});
+}
+
+ossia::node_ptr Execution::FaustEffectComponent::createNode()
+{
+  auto& proc = process();
+  for (auto& con : m_controls)
+    QObject::disconnect(con);
+  m_controls.clear();
+
+  m_dsp = proc.faust_object;
+  if (!m_dsp)
+    return std::make_shared<faust_placeholder_node>(
+        proc.inlets().empty() ? 0 : proc.inlets().size() - 1);
+
+  initCDSPInstance(m_dsp.get(), system().execState->sampleRate);
+  auto node = std::make_shared<ossia::nodes::faust>(m_dsp.get());
+  for (std::size_t i = 1; i < proc.inlets().size(); i++)
   {
-    initCDSPInstance(proc.faust_object, ctx.execState->sampleRate);
-    auto node = std::make_shared<ossia::nodes::faust>(proc.faust_object);
-    this->node = node;
-    m_ossia_process = std::make_shared<ossia::node_process>(node);
-    for (std::size_t i = 1; i < proc.inlets().size(); i++)
-    {
-      auto inlet = static_cast<Process::ControlInlet*>(proc.inlets()[i]);
-      *node->controls[i - 1].second = ossia::convert<double>(inlet->value());
-      auto inl = this->node->inputs()[i];
-      connect(
-          inlet, &Process::ControlInlet::valueChanged, this,
-          [this, inl](const ossia::value& v) {
-            system().executionQueue.enqueue([inl, val = v]() mutable {
-              inl->data.target<ossia::value_port>()->write_value(
-                  std::move(val), 0);
-            });
+    auto inlet = static_cast<Process::ControlInlet*>(proc.inlets()[i]);
+    *node->controls[i - 1].second = ossia::convert<double>(inlet->value());
+    auto inl = node->inputs()[i];
+    m_controls.push_back(connect(
+        inlet, &Process::ControlInlet::valueChanged, this,
+        [this, inl](const ossia::value& v) {
+          system().executionQueue.enqueue([inl, val = v]() mutable {
+            inl->data.target<ossia::value_port>()->write_value(
+                std::move(val), 0);
           });
-    }
+        }));
   }
+  return node;
+}
+
+void Execution::FaustEffectComponent::reloadNode()
+{
+  auto& proc = process();
+  auto& setup = system().setup;
+  const auto old_node = this->node;
+  auto old_dsp = m_dsp;
+
+  setup.unregister_node_soft(
+      m_registeredInlets, m_registeredOutlets, old_node);
+  setup.proc_map.erase(old_node.get());
+
+  auto new_node = createNode();
+  m_registeredInlets = proc.inlets();
+  m_registeredOutlets = proc.outlets();
+
+  std::vector<ExecutionCommand> commands;
+  setup.register_node(
+      m_registeredInlets, m_registeredOutlets, new_node, commands);
+  setup.proc_map[new_node.get()] = &proc;
+
+  commands.push_back(
+      [proc = m_ossia_process, new_node] { proc->node = new_node; });
+  nodeChanged(old_node, new_node, commands);
+
+  // The old instance is released on the execution thread, once its node is
+  // out of the graph.
+  commands.push_back([g = system().execGraph, old_node,
+                      old_dsp = std::move(old_dsp)]() mutable {
+    g->remove_node(old_node);
+    old_node->clear();
+    old_dsp.reset();
+  });
+  this->node = new_node;
+
+  in_exec([f = std::move(commands)] {
+    for (auto& cmd : f)
+      cmd();
+  });
+
+  // The cables of the old node were removed with it
+  auto reconnect = [&](Process::Port& port) {
+    for (const auto& cable : port.cables())
+      if (auto c = cable.try_find(system().doc))
+        setup.connectCable(*c);
+  };
+  for (auto inlet : proc.inlets())
+    reconnect(*inlet);
+  for (auto outlet : proc.outlets())
+    reconnect(*outlet);
 }
 }
 W_OBJECT_IMPL(Execution::FaustEffectComponent)
@@ -15,6 +15,8 @@
 #include <wobjectdefs.h>
 
 #include <faust/dsp/llvm-c-dsp.h>
+
+#include <memory>
 namespace Media::Faust
 {
 class FaustEffectModel;
@@ -73,12 +75,17 @@ public:
     return false;
   }
 
-  llvm_dsp_factory* faust_factory{};
-  llvm_dsp* faust_object{};
+  //! The instance keeps its factory alive. It is shared with the
+  //! execution, so that a replaced instance is freed by the thread which
+  //! last runs it.
+  std::shared_ptr<llvm_dsp> faust_object;
+
+  void dspChanged() E_SIGNAL(, dspChanged);
 
 private:
   void init();
   void reload();
+  void setFactory(llvm_dsp_factory* fac);
   QString m_text;
   QString m_declareName;
 };
@@ -151,6 +158,16 @@ public:
   FaustEffectComponent(
       Media::Faust::FaustEffectModel& proc, const Execution::Context& ctx,
       const Id<score::Component>& id, QObject* parent);
+  ~FaustEffectComponent() override;
+
+private:
+  ossia::node_ptr createNode();
+  void reloadNode();
+
+  std::shared_ptr<llvm_dsp> m_dsp;
+  Process::Inlets m_registeredInlets;
+  Process::Outlets m_registeredOutlets;
+  std::vector<QMetaObject::Connection> m_controls;
 };
 using FaustEffectComponentFactory
     = Execution::ProcessComponentFactory_T<FaustEffectComponent>;
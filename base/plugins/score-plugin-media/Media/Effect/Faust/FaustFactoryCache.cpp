@@ -0,0 +1,191 @@
+#if defined(HAS_FAUST)
+#include "FaustFactoryCache.hpp"
+
+#include <QCryptographicHash>
+#include <QDebug>
+#include <QDir>
+#include <QFile>
+#include <QSaveFile>
+#include <QStandardPaths>
+
+#include <wobjectimpl.h>
+W_OBJECT_IMPL(Media::Faust::FactoryCompiler)
+
+namespace Media::Faust
+{
+namespace
+{
+const char* const triple =
+#if defined(_MSC_VER)
+    "x86_64-pc-windows-msvc"
+#else
+    ""
+#endif
+    ;
+
+constexpr int optimization_level = -1;
+
+QByteArray cacheKey(const QByteArray& program)
+{
+  QCryptographicHash hash{QCryptographicHash::Sha1};
+  hash.addData(program);
+
+  // Everything which changes the generated code
+  hash.addData("-O" + QByteArray::number(optimization_level));
+  hash.addData(getCLibFaustVersion());
+  hash.addData(triple);
+  if (char* target = getCDSPMachineTarget())
+  {
+    hash.addData(target);
+    freeCMemory(target);
+  }
+
+  return hash.result().toHex();
+}
+
+QString cacheFile(const QByteArray& key)
+{
+  static const QString folder = [] {
+    auto path
+        = QStandardPaths::writableLocation(QStandardPaths::CacheLocation)
+          + "/faust";
+    QDir{}.mkpath(path);
+    return path;
+  }();
+  return folder + "/" + QString::fromLatin1(key) + ".fac";
+}
+
+llvm_dsp_factory* loadFactory(const QString& path)
+{
+  QFile f{path};
+  if (!f.open(QIODevice::ReadOnly))
+    return nullptr;
+
+  const auto code = f.readAll();
+  char err[4096] = {};
+  auto fac = readCDSPFactoryFromMachine(code.constData(), triple, err);
+  if (!fac)
+  {
+    // e.g. the file was truncated
+    qDebug() << "Faust: invalid cached factory: " << err;
+    f.close();
+    f.remove();
+  }
+  return fac;
+}
+
+void saveFactory(const QString& path, llvm_dsp_factory* fac)
+{
+  char* code = writeCDSPFactoryToMachine(fac, triple);
+  if (!code)
+    return;
+
+  // Written atomically since other instances may read the cache
+  QSaveFile f{path};
+  if (f.open(QIODevice::WriteOnly))
+  {
+    f.write(code);
+    f.commit();
+  }
+  freeCMemory(code);
+}
+}
+
+FactoryCompiler::FactoryCompiler()
+{
+  connect(
+      this, &FactoryCompiler::compiled, this, &FactoryCompiler::on_compiled,
+      Qt::QueuedConnection);
+
+  m_thread = std::thread{[this] { run(); }};
+}
+
+FactoryCompiler::~FactoryCompiler()
+{
+  {
+    std::lock_guard lock{m_mutex};
+    m_stop = true;
+  }
+  m_cv.notify_one();
+  m_thread.join();
+
+  for (auto& res : m_results)
+    if (res.factory)
+      deleteCDSPFactory(res.factory);
+}
+
+void FactoryCompiler::compile(
+    QObject* context, QByteArray program, callback done)
+{
+  {
+    std::lock_guard lock{m_mutex};
+    m_requests.push_back(
+        Request{context, std::move(program), std::move(done), nullptr});
+  }
+  m_cv.notify_one();
+}
+
+llvm_dsp_factory* FactoryCompiler::createFactory(const QByteArray& program)
+{
+  const auto file = cacheFile(cacheKey(program));
+  if (auto fac = loadFactory(file))
+    return fac;
+
+  char err[4096] = {};
+  const auto str = program.toStdString();
+  int argc = 0;
+  const char* argv[1]{};
+
+  auto fac = createCDSPFactoryFromString(
+      "score", str.c_str(), argc, argv, triple, err, optimization_level);
+
+  if (err[0] != 0)
+    qDebug() << "Faust error: " << err;
+  if (fac)
+    saveFactory(file, fac);
+  return fac;
+}
+
+void FactoryCompiler::run()
+{
+  for (;;)
+  {
+    Request req;
+    {
+      std::unique_lock lock{m_mutex};
+      m_cv.wait(lock, [this] { return m_stop || !m_requests.empty(); });
+      if (m_stop)
+        return;
+
+      req = std::move(m_requests.front());
+      m_requests.pop_front();
+    }
+
+    req.factory = createFactory(req.program);
+
+    {
+      std::lock_guard lock{m_mutex};
+      m_results.push_back(std::move(req));
+    }
+    compiled();
+  }
+}
+
+void FactoryCompiler::on_compiled()
+{
+  std::vector<Request> results;
+  {
+    std::lock_guard lock{m_mutex};
+    std::swap(results, m_results);
+  }
+
+  for (auto& res : results)
+  {
+    if (res.context)
+      res.done(res.factory);
+    else if (res.factory)
+      deleteCDSPFactory(res.factory);
+  }
+}
+}
+#endif
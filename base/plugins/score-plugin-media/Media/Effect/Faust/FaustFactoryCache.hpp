@@ -0,0 +1,73 @@
+#pragma once
+#if defined(HAS_FAUST)
+#include <QByteArray>
+#include <QObject>
+#include <QPointer>
+
+#include <score_plugin_media_export.h>
+#include <wobjectdefs.h>
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <faust/dsp/llvm-c-dsp.h>
+
+namespace Media::Faust
+{
+/**
+ * @brief Creates the DSP factories of the Faust effects
+ *
+ * Compiling a Faust program with the LLVM backend takes a long time, hence
+ * the compiled factories are saved in the cache folder of the user. They are
+ * keyed by a hash of the program, the compiler options, the version of
+ * libfaust and the machine target, so that a document is compiled only
+ * once per machine.
+ *
+ * Compilations are done one after the other on a separate thread.
+ */
+class SCORE_PLUGIN_MEDIA_EXPORT FactoryCompiler final : public QObject
+{
+  W_OBJECT(FactoryCompiler)
+public:
+  using callback = std::function<void(llvm_dsp_factory*)>;
+
+  FactoryCompiler();
+  ~FactoryCompiler();
+
+  //! done will be called on the GUI thread with the factory, or nullptr
+  //! if the program is invalid. It is not called if context is deleted
+  //! in-between.
+  void compile(QObject* context, QByteArray program, callback done);
+
+  //! Loads the factory from the cache, or compiles and caches it.
+  static llvm_dsp_factory* createFactory(const QByteArray& program);
+
+public:
+  void compiled() W_SIGNAL(compiled);
+
+private:
+  struct Request
+  {
+    QPointer<QObject> context;
+    QByteArray program;
+    callback done;
+    llvm_dsp_factory* factory{};
+  };
+
+  void run();
+  void on_compiled();
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<Request> m_requests;
+  std::vector<Request> m_results;
+  bool m_stop{};
+
+  std::thread m_thread;
+};
+}
+#endif
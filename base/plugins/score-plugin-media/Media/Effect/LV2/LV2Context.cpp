@@ -16,14 +16,6 @@ namespace LV2
 {
 namespace
 {
-struct WorkerData
-{
-  LV2::EffectContext& effect;
-
-  uint32_t size;
-  const void* data;
-};
-
 static LV2_URID
 do_uri_map(LV2_URI_Map_Callback_Data ptr, const char*, const char* val)
 {
@@ -85,30 +77,18 @@ static const char* do_unmap(LV2_URID_Unmap_Handle ptr, LV2_URID val)
 static LV2_Worker_Status
 do_worker(LV2_Worker_Schedule_Handle ptr, uint32_t s, const void* data)
 {
+  // Called by the plug-in in run(), hence in the audio thread :
+  // the work is done by the worker pool.
   auto& c = *static_cast<LV2::GlobalContext*>(ptr);
   LV2::EffectContext* cur = c.host.current;
-  if (cur->worker && !cur->worker_response)
-  {
-    auto& w = *cur->worker;
-    if (w.work)
-    {
-      w.work(
-          cur->instance->lv2_handle,
-          [](LV2_Worker_Respond_Handle sub_h, uint32_t sub_s,
-             const void* sub_d) {
-            return LV2_WORKER_ERR_UNKNOWN;
-            auto sub_c = static_cast<LV2::EffectContext*>(sub_h);
-            sub_c->worker_data.resize(sub_s);
-            std::copy_n((const char*)sub_d, sub_s, sub_c->worker_data.data());
+  if (!cur || !cur->worker || !cur->worker->work)
+    return LV2_WORKER_ERR_UNKNOWN;
 
-            sub_c->worker_response = true;
-            return LV2_WORKER_SUCCESS;
-          },
-          cur, s, data);
-      return LV2_WORKER_SUCCESS;
-    }
-  }
-  return LV2_WORKER_ERR_UNKNOWN;
+  if (!cur->worker_requests.write(s, data))
+    return LV2_WORKER_ERR_NO_SPACE;
+
+  c.worker_pool.notify();
+  return LV2_WORKER_SUCCESS;
 }
 
 static LV2_Worker_Status
@@ -1,4 +1,6 @@
 #pragma once
+#include <Media/Effect/LV2/LV2Worker.hpp>
+
 #include <score/tools/Todo.hpp>
 
 #include <ossia/detail/hash_map.hpp>
@@ -93,8 +95,10 @@ struct EffectContext
   const LilvNode* ui_type{};
   SuilInstance* ui_instance{};
 
-  std::vector<char> worker_data;
-  std::atomic_bool worker_response{false};
+  //! Work scheduled by the plug-in, and the responses of the worker
+  WorkerRing worker_requests{8192};
+  WorkerRing worker_responses{8192};
+  std::vector<char> worker_response;
 };
 
 struct GlobalContext
@@ -156,6 +160,8 @@ public:
 
   SuilHost* ui_host{};
 
+  WorkerPool worker_pool;
+
   const LV2_Feature data_feature{LV2_DATA_ACCESS_URI, &ext_data};
 };
 
@@ -114,6 +114,14 @@ struct lv2_node final : public ossia::graph_node
           lilv_instance_get_extension_data(fInstance, LV2_WORKER__interface));
     }
 
+    if (data.effect.worker)
+    {
+      // So that reading the responses in run() does not allocate
+      data.effect.worker_response.reserve(
+          data.effect.worker_responses.capacity());
+      data.host.global->worker_pool.add(data.effect);
+    }
+
     for (std::size_t i = 0; i < control_in_size; i++)
     {
       auto port_i = data.control_in_ports[i];
@@ -202,15 +210,6 @@ struct lv2_node final : public ossia::graph_node
 
   void postProcess(int64_t offset)
   {
-    if (data.effect.worker && data.effect.worker_response
-        && data.effect.worker->work_response)
-    {
-      data.effect.worker->work_response(
-          data.effect.instance->lv2_handle, data.effect.worker_data.size(),
-          data.effect.worker_data.data());
-      data.effect.worker_response = false;
-    }
-
     if (data.effect.worker && data.effect.worker->end_run)
     {
       data.effect.worker->end_run(data.effect.instance->lv2_handle);
@@ -271,6 +270,8 @@ struct lv2_node final : public ossia::graph_node
 
   ~lv2_node() override
   {
+    if (data.effect.worker)
+      data.host.global->worker_pool.remove(data.effect);
     lilv_instance_deactivate(fInstance);
   }
 
@@ -279,6 +280,8 @@ struct lv2_node final : public ossia::graph_node
     if (tk.date > tk.prev_date)
     {
       data.host.current = &data.effect;
+      if (data.effect.worker)
+        deliverWorkerResponses(data.effect);
       preProcess();
 
       const std::size_t samples = tk.date - tk.prev_date;
@@ -0,0 +1,168 @@
+#include "LV2Worker.hpp"
+
+#include "LV2Context.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace Media::LV2
+{
+WorkerRing::WorkerRing(std::size_t capacity)
+    : m_buffer(capacity), m_mask{capacity - 1}
+{
+}
+
+void WorkerRing::copyIn(
+    std::size_t pos, const void* data, std::size_t size) noexcept
+{
+  const auto begin = pos & m_mask;
+  const auto first = std::min(size, m_buffer.size() - begin);
+  std::memcpy(m_buffer.data() + begin, data, first);
+  std::memcpy(m_buffer.data(), (const char*)data + first, size - first);
+}
+
+void WorkerRing::copyOut(
+    std::size_t pos, void* data, std::size_t size) const noexcept
+{
+  const auto begin = pos & m_mask;
+  const auto first = std::min(size, m_buffer.size() - begin);
+  std::memcpy(data, m_buffer.data() + begin, first);
+  std::memcpy((char*)data + first, m_buffer.data(), size - first);
+}
+
+bool WorkerRing::write(uint32_t size, const void* data) noexcept
+{
+  const auto w = m_write.load(std::memory_order_relaxed);
+  const auto r = m_read.load(std::memory_order_acquire);
+  if (m_buffer.size() - (w - r) < sizeof(size) + size)
+    return false;
+
+  copyIn(w, &size, sizeof(size));
+  copyIn(w + sizeof(size), data, size);
+  m_write.store(w + sizeof(size) + size, std::memory_order_release);
+  return true;
+}
+
+bool WorkerRing::read(std::vector<char>& buf) noexcept
+{
+  const auto r = m_read.load(std::memory_order_relaxed);
+  const auto w = m_write.load(std::memory_order_acquire);
+  if (w == r)
+    return false;
+
+  uint32_t size{};
+  copyOut(r, &size, sizeof(size));
+  buf.resize(size);
+  copyOut(r + sizeof(size), buf.data(), size);
+  m_read.store(r + sizeof(size) + size, std::memory_order_release);
+  return true;
+}
+
+WorkerPool::WorkerPool()
+{
+  m_thread = std::thread{[this] { run(); }};
+}
+
+WorkerPool::~WorkerPool()
+{
+  {
+    std::lock_guard lock{m_mutex};
+    m_stop = true;
+  }
+  m_cv.notify_one();
+  m_thread.join();
+}
+
+void WorkerPool::add(EffectContext& effect)
+{
+  std::lock_guard lock{m_mutex};
+  m_effects.push_back(&effect);
+}
+
+void WorkerPool::remove(EffectContext& effect)
+{
+  std::unique_lock lock{m_mutex};
+  m_effects.erase(
+      std::remove(m_effects.begin(), m_effects.end(), &effect),
+      m_effects.end());
+  m_done.wait(lock, [&] { return m_current != &effect; });
+}
+
+void WorkerPool::notify() noexcept
+{
+  // Not under the mutex, so that the audio thread never blocks ;
+  // a missed notification is caught by the timeout of the worker.
+  m_cv.notify_one();
+}
+
+bool WorkerPool::work(EffectContext& effect, std::vector<char>& request)
+{
+  // Bounded, so that an effect which keeps scheduling work does not
+  // starve the others nor block its removal.
+  constexpr int max_requests = 64;
+
+  auto& w = *effect.worker;
+  int count = 0;
+  while (count < max_requests && effect.worker_requests.read(request))
+  {
+    count++;
+    w.work(
+        effect.instance->lv2_handle,
+        [](LV2_Worker_Respond_Handle h, uint32_t size, const void* data) {
+          auto& e = *static_cast<EffectContext*>(h);
+          return e.worker_responses.write(size, data)
+                     ? LV2_WORKER_SUCCESS
+                     : LV2_WORKER_ERR_NO_SPACE;
+        },
+        &effect, request.size(), request.data());
+  }
+  return count > 0;
+}
+
+void WorkerPool::run()
+{
+  std::vector<char> request;
+  std::vector<EffectContext*> effects;
+  std::unique_lock lock{m_mutex};
+  while (!m_stop)
+  {
+    // The plug-ins work outside of the mutex, so that adding and removing
+    // effects does not wait for them.
+    effects = m_effects;
+
+    bool worked = false;
+    for (EffectContext* effect : effects)
+    {
+      // Removed since the copy
+      if (std::find(m_effects.begin(), m_effects.end(), effect)
+          == m_effects.end())
+        continue;
+
+      m_current = effect;
+      lock.unlock();
+      worked |= work(*effect, request);
+      lock.lock();
+      m_current = nullptr;
+      m_done.notify_all();
+    }
+
+    if (!worked)
+      m_cv.wait_for(lock, std::chrono::milliseconds{10});
+  }
+}
+
+void deliverWorkerResponses(EffectContext& effect) noexcept
+{
+  auto& w = *effect.worker;
+  if (!w.work_response)
+    return;
+
+  while (effect.worker_responses.read(effect.worker_response))
+  {
+    w.work_response(
+        effect.instance->lv2_handle, effect.worker_response.size(),
+        effect.worker_response.data());
+  }
+}
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <lv2/lv2plug.in/ns/ext/worker/worker.h>
+#include <score_plugin_media_export.h>
+
+namespace Media::LV2
+{
+struct EffectContext;
+
+/**
+ * @brief Single-producer, single-consumer ring of worker messages
+ *
+ * Each message is its size followed by its bytes.
+ * Neither writing nor reading allocates or locks, so that both can be done
+ * in the audio thread.
+ */
+class SCORE_PLUGIN_MEDIA_EXPORT WorkerRing
+{
+public:
+  //! capacity must be a power of two
+  explicit WorkerRing(std::size_t capacity);
+
+  //! Returns false if there is not enough space for the message.
+  bool write(uint32_t size, const void* data) noexcept;
+
+  //! Returns false if the ring is empty. buf is not resized beyond the
+  //! capacity of the ring, hence reserving it beforehand avoids allocating.
+  bool read(std::vector<char>& buf) noexcept;
+
+  std::size_t capacity() const noexcept
+  {
+    return m_buffer.size();
+  }
+
+private:
+  void copyIn(std::size_t pos, const void* data, std::size_t size) noexcept;
+  void copyOut(std::size_t pos, void* data, std::size_t size) const noexcept;
+
+  std::vector<char> m_buffer;
+  const std::size_t m_mask{};
+  std::atomic<std::size_t> m_read{};
+  std::atomic<std::size_t> m_write{};
+};
+
+/**
+ * @brief Runs the work of the LV2 plug-ins outside of the audio thread
+ *
+ * The plug-ins schedule work from run() ; the requests go through the
+ * request ring of their instance, are processed by the worker thread, and
+ * the responses go back through the response ring, to be given to the
+ * plug-in at the beginning of its next run().
+ *
+ * A single thread is shared by all the instances : the LV2 specification
+ * requires that work() is never called concurrently for an instance.
+ */
+class SCORE_PLUGIN_MEDIA_EXPORT WorkerPool
+{
+public:
+  WorkerPool();
+  ~WorkerPool();
+
+  void add(EffectContext& effect);
+
+  //! Waits for the work in progress of the effect, if any ; the work of
+  //! the other effects does not block.
+  void remove(EffectContext& effect);
+
+  //! Called from the audio thread when a request was written.
+  void notify() noexcept;
+
+private:
+  void run();
+  bool work(EffectContext& effect, std::vector<char>& request);
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::vector<EffectContext*> m_effects;
+  bool m_stop{};
+
+  //! The effect whose work() is being called, outside of the mutex
+  EffectContext* m_current{};
+  std::condition_variable m_done;
+
+  std::thread m_thread;
+};
+
+//! Gives the pending responses to the plug-in ; called in the audio thread.
+SCORE_PLUGIN_MEDIA_EXPORT
+void deliverWorkerResponses(EffectContext& effect) noexcept;
+}
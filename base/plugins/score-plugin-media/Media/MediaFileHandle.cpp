@@ -32,7 +32,8 @@ void MediaFileHandle::load(
     m_hdl = std::make_shared<ossia::audio_data>();
     m_decoder.decode(m_file, m_hdl);
 
-    m_sampleRate = 44100; // for now everything is reencoded
+    // Resampled when played
+    m_sampleRate = m_decoder.sampleRate;
 
     m_data.resize(m_hdl->data.size());
     for (std::size_t i = 0; i < m_hdl->data.size(); i++)
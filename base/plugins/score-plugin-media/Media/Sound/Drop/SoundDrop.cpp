@@ -25,10 +25,14 @@ DroppedAudioFiles::DroppedAudioFiles(const QMimeData& mime)
     if (auto info_opt = dec.probe(filename))
     {
       auto info = *info_opt;
-      if (info.channels > 0 && info.length > 0)
+      if (info.channels > 0 && info.length > 0 && info.rate > 0)
       {
-        files.emplace_back(std::make_pair(filename, info.length));
-        maxDuration = std::max((int64_t)maxDuration, (int64_t)info.length);
+        // The length is in samples of the file
+        const auto dur
+            = TimeVal::fromMsecs(1000. * double(info.length) / info.rate);
+        files.emplace_back(std::make_pair(filename, dur));
+        if (dur > maxDuration)
+          maxDuration = dur;
       }
     }
   }
@@ -36,8 +40,7 @@ DroppedAudioFiles::DroppedAudioFiles(const QMimeData& mime)
 
 TimeVal DroppedAudioFiles::dropMaxDuration() const
 {
-  // TODO use settings Samplerate
-  return TimeVal::fromMsecs(maxDuration / 44.1);
+  return maxDuration;
 }
 
 QSet<QString> DropHandler::mimeTypes() const noexcept
@@ -64,7 +67,7 @@ std::vector<Process::ProcessDropHandler::ProcessDrop> DropHandler::drop(
   {
     Process::ProcessDropHandler::ProcessDrop p;
     p.creation.key = Metadata<ConcreteKey_k, Sound::ProcessModel>::get();
-    p.duration = TimeVal{file.second};
+    p.duration = file.second;
     p.setup = [f=std::move(file.first),song_t=*p.duration] (Process::ProcessModel& m, score::Dispatcher& disp) {
       auto& proc = static_cast<Sound::ProcessModel&>(m);
       disp.submit(new Media::ChangeAudioFile{proc, std::move(f)});
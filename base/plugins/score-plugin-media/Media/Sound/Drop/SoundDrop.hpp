@@ -11,12 +11,12 @@ struct DroppedAudioFiles
 
   bool valid() const
   {
-    return !files.empty() && maxDuration != 0;
+    return !files.empty() && !maxDuration.isZero();
   }
 
   TimeVal dropMaxDuration() const;
-  int64_t maxDuration = 0;
-  std::vector<std::pair<QString, int64_t>> files;
+  TimeVal maxDuration = TimeVal::zero();
+  std::vector<std::pair<QString, TimeVal>> files;
 };
 
 /**
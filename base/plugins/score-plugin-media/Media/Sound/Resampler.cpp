@@ -0,0 +1,41 @@
+#include "Resampler.hpp"
+
+#include <ossia/detail/math.hpp>
+
+#include <algorithm>
+
+namespace Media::Sound
+{
+PolyphaseResampler::PolyphaseResampler(double ratio) : m_ratio{ratio}
+{
+  // Keep some room for the transition band
+  const double cutoff = 0.95 * std::min(1., 1. / ratio);
+  constexpr int half = taps / 2 - 1;
+
+  m_table.resize((phases + 1) * taps);
+  for (int p = 0; p <= phases; p++)
+  {
+    float* row = m_table.data() + p * taps;
+    const double frac = double(p) / phases;
+
+    double sum = 0.;
+    for (int j = 0; j < taps; j++)
+    {
+      // Distance between the read position and the input sample
+      const double x = (j - half) - frac;
+      const double arg = ossia::pi * cutoff * x;
+      const double sinc = x == 0. ? 1. : std::sin(arg) / arg;
+      const double w = 2. * ossia::pi * x / taps;
+      const double window
+          = 0.42 + 0.5 * std::cos(w) + 0.08 * std::cos(2. * w);
+
+      row[j] = float(sinc * window);
+      sum += row[j];
+    }
+
+    // Unity gain for each phase
+    for (int j = 0; j < taps; j++)
+      row[j] = float(row[j] / sum);
+  }
+}
+}
@@ -0,0 +1,109 @@
+#pragma once
+#include <score_plugin_media_export.h>
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace Media::Sound
+{
+/**
+ * @brief Band-limited interpolation of a buffer at fractional positions
+ *
+ * The filter is a Blackman-windowed sinc of `taps` points, tabulated for
+ * `phases` fractional offsets between two input samples ; an output sample
+ * is the dot product of the input around the read position with the
+ * linear interpolation of the two nearest phases.
+ *
+ * The dot product is done on fixed-size blocks of independent accumulators,
+ * which lets the compiler vectorize it without relaxing the floating-point
+ * semantics.
+ *
+ * The table is built for a given ratio of input to output samples: above
+ * 1, the cutoff is lowered accordingly to prevent aliasing. Reading at
+ * another speed than the ratio is possible, but a faster speed is not
+ * band-limited.
+ */
+class SCORE_PLUGIN_MEDIA_EXPORT PolyphaseResampler
+{
+public:
+  static constexpr int taps = 32;
+  static constexpr int phases = 256;
+
+  explicit PolyphaseResampler(double ratio = 1.);
+
+  double ratio() const noexcept
+  {
+    return m_ratio;
+  }
+
+  /**
+   * @brief Writes n samples to out
+   *
+   * The input is read starting from pos, advancing by step input samples
+   * at each output sample. Input samples outside of [0, in_size) are zero.
+   */
+  template <typename In, typename Out>
+  void process(
+      const In* in, int64_t in_size, double pos, double step, Out* out,
+      int64_t n) const noexcept
+  {
+    constexpr int half = taps / 2 - 1;
+    constexpr int lanes = 8;
+    static_assert(taps % lanes == 0);
+
+    for (int64_t k = 0; k < n; k++, pos += step)
+    {
+      const double base = std::floor(pos);
+      const int64_t first = int64_t(base) - half;
+
+      const double phase = (pos - base) * phases;
+      const int p = int(phase);
+      const float frac = float(phase - p);
+      const float* k0 = m_table.data() + p * taps;
+      const float* k1 = k0 + taps;
+
+      if (first >= 0 && first + taps <= in_size)
+      {
+        const In* src = in + first;
+        float acc[lanes]{};
+        for (int j = 0; j < taps; j += lanes)
+        {
+          for (int l = 0; l < lanes; l++)
+          {
+            const float h = k0[j + l] + frac * (k1[j + l] - k0[j + l]);
+            acc[l] += float(src[j + l]) * h;
+          }
+        }
+
+        float sum = 0.f;
+        for (int l = 0; l < lanes; l++)
+          sum += acc[l];
+        out[k] = Out(sum);
+      }
+      else if (first + taps <= 0 || first >= in_size)
+      {
+        out[k] = Out{};
+      }
+      else
+      {
+        // Beginning or end of the buffer
+        float sum = 0.f;
+        for (int j = 0; j < taps; j++)
+        {
+          const int64_t i = first + j;
+          if (i >= 0 && i < in_size)
+            sum += float(in[i]) * (k0[j] + frac * (k1[j] - k0[j]));
+        }
+        out[k] = Out(sum);
+      }
+    }
+  }
+
+private:
+  // (phases + 1) rows of taps coefficients, the last row being the
+  // first one shifted by one sample.
+  std::vector<float> m_table;
+  double m_ratio{};
+};
+}
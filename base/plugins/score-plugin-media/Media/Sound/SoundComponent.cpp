@@ -1,15 +1,16 @@
 #include "SoundComponent.hpp"
 
+#include <Media/Sound/SoundNode.hpp>
 #include <Process/ExecutionContext.hpp>
 #include <Scenario/Execution/score2OSSIA.hpp>
 
 #include <ossia/dataflow/execution_state.hpp>
-#include <ossia/dataflow/nodes/sound.hpp>
-#include <ossia/detail/pod_vector.hpp>
+
+#include <cmath>
 
 namespace Execution
 {
-using sound_proc_type = ossia::nodes::sound_ref;
+using sound_proc_type = Media::Sound::sound_node;
 
 SoundComponent::SoundComponent(
     Media::Sound::ProcessModel& element, const Execution::Context& ctx,
@@ -35,52 +36,45 @@ SoundComponent::SoundComponent(
         [node, upmix = process().upmixChannels()] { node->set_upmix(upmix); });
   });
   con(element, &Media::Sound::ProcessModel::startOffsetChanged, this, [=] {
-    in_exec([node, off = process().startOffset()] {
-      node->set_start_offset(off);
-    });
+    in_exec([node, off = startOffset()] { node->set_start_offset(off); });
   });
   recompute();
 }
 
+int64_t SoundComponent::startOffset() const
+{
+  // The offset of the model is in samples at 44.1 kHz, as when the files
+  // were resampled to this rate while decoding.
+  const auto& file = process().file();
+  const double rate = file.sampleRate() > 0 ? file.sampleRate() : 44100.;
+  return std::llround(process().startOffset() * rate / 44100.);
+}
+
 void SoundComponent::recompute()
 {
-  if constexpr (std::is_same_v<sound_proc_type, ossia::nodes::sound>)
-  {
-    auto to_double = [](const auto& float_vec) {
-      std::vector<ossia::double_vector> v;
-      v.reserve(float_vec.size());
-      for (auto& chan : float_vec)
-      {
-        v.emplace_back(chan.begin(), chan.end());
-      }
-      return v;
-    };
-    in_exec(
-        [n
-         = std::dynamic_pointer_cast<ossia::nodes::sound>(OSSIAProcess().node),
-         data = to_double(process().file().data()),
-         upmix = process().upmixChannels(), start = process().startChannel(),
-         startOff = process().startOffset()]() mutable {
-          n->set_sound(std::move(data));
-          n->set_start(start);
-          n->set_start_offset(startOff);
-          n->set_upmix(upmix);
-        });
-  }
-  else
-  {
-    in_exec([n = std::dynamic_pointer_cast<ossia::nodes::sound_ref>(
-                 OSSIAProcess().node),
-             data = process().file().handle(),
-             upmix = process().upmixChannels(),
-             start = process().startChannel(),
-             startOff = process().startOffset()] {
-      n->set_sound(std::move(data));
-      n->set_start(start);
-      n->set_start_offset(startOff);
-      n->set_upmix(upmix);
-    });
-  }
+  // The resampler is created here since its filter is costly to compute
+  const auto& file = process().file();
+  const double rate = system().execState->sampleRate;
+  Media::Sound::PolyphaseResampler resampler{
+      file.sampleRate() > 0 ? file.sampleRate() / rate : 1.};
+  std::vector<float> scratch(
+      std::max(system().execState->bufferSize, 1024));
+
+  // The previous sound and resampler are sent back to be freed here
+  in_exec([n = std::dynamic_pointer_cast<sound_proc_type>(
+               OSSIAProcess().node),
+           &edit = system().editionQueue, data = file.handle(),
+           res = std::move(resampler), scratch = std::move(scratch),
+           upmix = process().upmixChannels(),
+           start = process().startChannel(),
+           startOff = startOffset()]() mutable {
+    n->set_sound(data, res, scratch);
+    n->set_start(start);
+    n->set_start_offset(startOff);
+    n->set_upmix(upmix);
+    edit.enqueue([data = std::move(data), res = std::move(res),
+                  scratch = std::move(scratch)] {});
+  });
 }
 
 SoundComponent::~SoundComponent()
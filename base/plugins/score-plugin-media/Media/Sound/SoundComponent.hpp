@@ -27,6 +27,8 @@ public:
   ~SoundComponent() override;
 
 private:
+  //! In samples of the file
+  int64_t startOffset() const;
 };
 
 using SoundComponentFactory
@@ -0,0 +1,111 @@
+#include "SoundNode.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Media::Sound
+{
+sound_node::sound_node()
+{
+  m_outlets.push_back(ossia::make_outlet<ossia::audio_port>());
+}
+
+sound_node::~sound_node()
+{
+}
+
+std::string sound_node::label() const noexcept
+{
+  return "sound";
+}
+
+void sound_node::run(
+    ossia::token_request tk, ossia::exec_state_facade) noexcept
+{
+  if (!m_handle || m_handle->data.empty() || tk.speed == 0.)
+    return;
+
+  const auto& data = m_handle->data;
+  const int64_t len = data[0].size();
+
+  // The tick covers this duration of the parent interval, and is played
+  // in `frames` samples of the audio buffer.
+  const double model = tk.date.impl - tk.prev_date.impl;
+  const int64_t frames = std::llround(std::abs(model / tk.speed));
+  if (frames <= 0)
+    return;
+
+  const double ratio = m_resampler.ratio();
+  const double pos = tk.prev_date.impl * ratio + m_start_offset;
+  const double step = model * ratio / frames;
+
+  // Nothing left to play
+  constexpr int taps = PolyphaseResampler::taps;
+  const double end = pos + step * frames;
+  if (std::min(pos, end) >= len + taps || std::max(pos, end) < -taps)
+    return;
+
+  auto& ap = *m_outlets[0]->data.target<ossia::audio_port>();
+  const std::size_t chan = data.size();
+  const int64_t offset = tk.offset.impl;
+
+  // The channels are written directly where they are output, after
+  // m_start empty channels, so that up- and downmixing do not reallocate
+  // the channels of the port.
+  const std::size_t out_chan = m_upmix != 0 ? m_upmix : chan;
+  ap.samples.resize(m_start + out_chan);
+  for (std::size_t i = m_start; i < m_start + out_chan; i++)
+  {
+    auto& out = ap.samples[i];
+    if ((int64_t)out.size() < offset + frames)
+      out.resize(offset + frames);
+  }
+
+  if (out_chan == chan)
+  {
+    for (std::size_t i = 0; i < chan; i++)
+    {
+      m_resampler.process(
+          data[i].data(), len, pos, step,
+          ap.samples[m_start + i].data() + offset, frames);
+    }
+  }
+  else if (out_chan > chan && chan == 1)
+  {
+    // Mono upmix: the first channel is copied in the others
+    auto& mono = ap.samples[m_start];
+    m_resampler.process(
+        data[0].data(), len, pos, step, mono.data() + offset, frames);
+    for (std::size_t i = m_start + 1; i < m_start + out_chan; i++)
+      std::copy_n(
+          mono.data() + offset, frames, ap.samples[i].data() + offset);
+  }
+  else
+  {
+    // Downmix, or upmix of several channels: the extra channels are summed
+    // in the others through the scratch buffer, in blocks of its size.
+    const std::size_t direct = std::min(chan, out_chan);
+    for (std::size_t i = 0; i < direct; i++)
+    {
+      m_resampler.process(
+          data[i].data(), len, pos, step,
+          ap.samples[m_start + i].data() + offset, frames);
+    }
+
+    const int64_t block = m_scratch.size();
+    for (std::size_t i = direct; i < chan && block > 0; i++)
+    {
+      auto& dst = ap.samples[m_start + i % out_chan];
+      for (int64_t done = 0; done < frames; done += block)
+      {
+        const int64_t n = std::min(block, frames - done);
+        m_resampler.process(
+            data[i].data(), len, pos + done * step, step, m_scratch.data(),
+            n);
+        for (int64_t j = 0; j < n; j++)
+          dst[offset + done + j] += m_scratch[j];
+      }
+    }
+  }
+}
+}
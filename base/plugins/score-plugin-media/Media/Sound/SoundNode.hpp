@@ -0,0 +1,67 @@
+#pragma once
+#include <Media/AudioArray.hpp>
+#include <Media/Sound/Resampler.hpp>
+
+#include <ossia/dataflow/graph_node.hpp>
+#include <ossia/dataflow/port.hpp>
+
+#include <vector>
+
+namespace Media::Sound
+{
+/**
+ * @brief Plays a sound file at the sample rate of the engine
+ *
+ * The file is kept at its own sample rate and is converted while playing,
+ * which also takes into account the speed of the parent interval.
+ */
+class sound_node final : public ossia::graph_node
+{
+public:
+  sound_node();
+  ~sound_node() override;
+
+  std::string label() const noexcept override;
+
+  //! The ratio of the resampler is the ratio between the sample rate of
+  //! the file and the sample rate of the engine.
+  //! The previous sound and resampler are swapped into the arguments, so
+  //! that the caller frees them outside of the audio thread.
+  //! The scratch buffer for downmixing is also built by the caller, with
+  //! the size of the audio buffers.
+  void set_sound(
+      ossia::audio_handle& hdl, PolyphaseResampler& res,
+      std::vector<float>& scratch) noexcept
+  {
+    std::swap(m_handle, hdl);
+    std::swap(m_resampler, res);
+    std::swap(m_scratch, scratch);
+  }
+
+  void set_start(std::size_t v) noexcept
+  {
+    m_start = v;
+  }
+  void set_upmix(std::size_t v) noexcept
+  {
+    m_upmix = v;
+  }
+  void set_start_offset(int64_t v) noexcept
+  {
+    m_start_offset = v;
+  }
+
+  void
+  run(ossia::token_request tk, ossia::exec_state_facade st) noexcept override;
+
+private:
+  ossia::audio_handle m_handle;
+  PolyphaseResampler m_resampler;
+  std::vector<float> m_scratch;
+
+  std::size_t m_start{};
+  std::size_t m_upmix{};
+  // In samples of the file
+  int64_t m_start_offset{};
+};
+}
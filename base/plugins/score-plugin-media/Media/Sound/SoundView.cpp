@@ -5,11 +5,10 @@
 #include <ossia/detail/pod_vector.hpp>
 
 #include <QGraphicsSceneContextMenuEvent>
-#include <QGraphicsView>
 #include <QPainter>
-#include <QScrollBar>
 #include <QTimer>
 
+#include <algorithm>
 #include <cmath>
 
 #if defined(__AVX2__) && __has_include(<immintrin.h>)
@@ -25,22 +24,26 @@ namespace Media
 {
 namespace Sound
 {
+namespace
+{
+// The waveform of each channel is split in paths of this width, so that
+// painting a part of the layer only draws the paths which cross it.
+constexpr qreal chunk_width = 256.;
+}
+
 LayerView::LayerView(QGraphicsItem* parent)
     : Process::LayerView{parent}, m_cpt{new WaveformComputer{*this}}
 {
   setFlag(ItemClipsToShape, true);
   this->setAcceptDrops(true);
-  if (auto view = getView(*parent))
-    connect(
-        view->horizontalScrollBar(), &QScrollBar::valueChanged, this,
-        &Media::Sound::LayerView::scrollValueChanged);
+  setCached(true);
   connect(
       m_cpt, &WaveformComputer::ready, this,
       [=](QList<QPainterPath> p, QPainterPath c, double z) {
         m_paths = std::move(p);
         m_channels = std::move(c);
         m_pathZoom = z;
-        update();
+        invalidate();
       });
 }
 
@@ -103,10 +106,26 @@ void LayerView::paint_impl(QPainter* painter) const
   painter->setBrush(Qt::darkCyan);
   painter->setPen(Qt::darkBlue);
 
+  // m_paths holds the chunks of the first channel, then of the second, etc.
+  const int chunks = m_paths.size() / nchannels;
+  if (chunks == 0)
+    return;
+
+  // Only the chunks in the clip of the painter, e.g. a tile of the layer
+  int first = 0;
+  int last = chunks - 1;
+  if (painter->hasClipping())
+  {
+    const auto clip = painter->clipBoundingRect();
+    first = std::clamp(int(clip.left() / chunk_width), 0, chunks - 1);
+    last = std::clamp(int(clip.right() / chunk_width), first, chunks - 1);
+  }
+
   painter->save();
 
-  for (const auto& path : m_paths)
-    painter->drawPath(path);
+  for (int c = 0; c < nchannels; c++)
+    for (int i = first; i <= last; i++)
+      painter->drawPath(m_paths[c * chunks + i]);
 
   const auto h = -height() / nchannels;
   const auto dblh = 2. * h;
@@ -114,9 +133,10 @@ void LayerView::paint_impl(QPainter* painter) const
   painter->scale(1, -1);
   painter->translate(0, h + 1);
 
-  for (const auto& path : m_paths)
+  for (int c = 0; c < nchannels; c++)
   {
-    painter->drawPath(path);
+    for (int i = first; i <= last; i++)
+      painter->drawPath(m_paths[c * chunks + i]);
     painter->translate(0., dblh + 1);
   }
 
@@ -126,11 +146,6 @@ void LayerView::paint_impl(QPainter* painter) const
   painter->drawPath(m_channels);
 }
 
-void LayerView::scrollValueChanged(int sbvalue)
-{
-  recompute(m_zoom);
-}
-
 void LayerView::on_finishedDecoding()
 {
   m_cpt->dirty = true;
@@ -309,44 +324,44 @@ void WaveformComputer::drawWaveForms(
     channels.lineTo(w, c * h);
   }
 
-  // Get horizontal offset
-  auto view = getView(m_layer);
-  if (!view)
-    return;
-  auto x0
-      = std::max(m_layer.mapFromScene(view->mapToScene(0, 0)).x(), qreal(0));
-
-  int64_t i0 = x0 / densityratio;
   const int64_t n = m_curdata[0].size();
   if (n == 0)
     return;
 
-  auto xf = m_layer.mapFromScene(view->mapToScene(view->width(), 0)).x();
+  // The whole width of the layer is computed, so that the paths do not
+  // depend on the scrolling of the view.
+  const int64_t chunks
+      = std::max(int64_t(1), int64_t(std::ceil(w / chunk_width)));
+  const float half_h = h / 2.f;
 
   for (int64_t c = 0; c < nchannels; ++c)
   {
     const int64_t current_height = c * h;
     const ossia::float_vector& dataset = m_curdata[c];
-
-    QPainterPath path{};
-    path.setFillRule(Qt::WindingFill);
-
-    // Draw path for current channel
-
-    const float half_h = h / 2.f;
     const float height_adjustemnt = current_height + half_h;
-    if (n > i0)
+
+    for (int64_t k = 0; k < chunks; ++k)
     {
-      path.moveTo(x0, double(dataset[i0] + height_adjustemnt));
-      double x = x0;
-      for (int64_t i = i0; (i < n) && (x <= xf); ++i)
+      QPainterPath path{};
+      path.setFillRule(Qt::WindingFill);
+
+      // Draw path for current channel, from the point before the start of
+      // the chunk to the point after its end so that chunks join.
+      const double xf = (k + 1) * chunk_width;
+      const int64_t i0 = (k * chunk_width) / densityratio;
+      if (n > i0)
       {
-        x = i * densityratio;
-        path.lineTo(x, double(dataset[i] * half_h + height_adjustemnt));
+        double x = i0 * densityratio;
+        path.moveTo(x, double(height_adjustemnt));
+        for (int64_t i = i0; (i < n) && (x <= xf); ++i)
+        {
+          x = i * densityratio;
+          path.lineTo(x, double(dataset[i] * half_h + height_adjustemnt));
+        }
+        path.lineTo(x, height_adjustemnt);
       }
-      path.lineTo(x, height_adjustemnt);
+      paths.push_back(std::move(path));
     }
-    paths.push_back(std::move(path));
   }
 
   ready(std::move(paths), std::move(channels), ratio);
@@ -97,8 +97,6 @@ private:
   void dragMoveEvent(QGraphicsSceneDragDropEvent* event) override;
   void dropEvent(QGraphicsSceneDragDropEvent* event) override;
 
-  void scrollValueChanged(int);
-
   void on_finishedDecoding();
   void on_newData();
 
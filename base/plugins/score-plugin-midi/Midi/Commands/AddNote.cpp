@@ -12,7 +12,7 @@ namespace Midi
 {
 
 AddNote::AddNote(const ProcessModel& model, const NoteData& n)
-    : m_model{model}, m_id{getStrongId(model.notes)}, m_note{n}
+    : m_model{model}, m_id{getStrongId(model.notes.ids())}, m_note{n}
 {
 }
 
@@ -23,8 +23,7 @@ void AddNote::undo(const score::DocumentContext& ctx) const
 
 void AddNote::redo(const score::DocumentContext& ctx) const
 {
-  auto& model = m_model.find(ctx);
-  model.notes.add(new Note{m_id, m_note, &model});
+  m_model.find(ctx).notes.add(m_id, m_note);
 }
 
 void AddNote::serializeImpl(DataStreamInput& s) const
@@ -48,11 +47,9 @@ ReplaceNotes::ReplaceNotes(
     , m_olddur{model.duration()}
     , m_newdur{d}
 {
-  for (Note& note : model.notes)
-  {
-    m_old.push_back({note.id(), note.noteData()});
-  }
+  m_old = model.notes.list();
 
+  m_new.reserve(n.size());
   int i = 0;
   for (auto& note : n)
     m_new.push_back({Id<Midi::Note>{i++}, note});
@@ -61,11 +58,8 @@ ReplaceNotes::ReplaceNotes(
 void ReplaceNotes::undo(const score::DocumentContext& ctx) const
 {
   auto& model = m_model.find(ctx);
-  model.notes.clear();
   model.setDuration(m_olddur);
-
-  for (auto& note : m_old)
-    model.notes.add(new Note{note.first, note.second, &model});
+  model.notes.replace(m_old);
 
   model.setRange(m_oldmin, m_oldmax);
 }
@@ -73,11 +67,8 @@ void ReplaceNotes::undo(const score::DocumentContext& ctx) const
 void ReplaceNotes::redo(const score::DocumentContext& ctx) const
 {
   auto& model = m_model.find(ctx);
-  model.notes.clear();
   model.setDuration(m_newdur);
-
-  for (auto& note : m_new)
-    model.notes.add(new Note{note.first, note.second, &model});
+  model.notes.replace(m_new);
 
   model.setRange(m_newmin, m_newmax);
 }
@@ -18,35 +18,22 @@ MoveNotes::MoveNotes(
   m_after.reserve(to_move.size());
   for (auto& note_id : to_move)
   {
-    auto& note = model.notes.at(note_id);
-    NoteData data = note.noteData();
-    m_before.push_back(qMakePair(note.id(), data));
+    NoteData data = model.notes.at(note_id);
+    m_before.push_back({note_id, data});
     data.m_pitch = qBound(0, data.m_pitch + note_delta, 127);
     data.m_start = std::max(data.m_start + t_delta, 0.);
-    m_after.push_back(qMakePair(note.id(), data));
+    m_after.push_back({note_id, data});
   }
 }
 
 void MoveNotes::undo(const score::DocumentContext& ctx) const
 {
-  auto& model = m_model.find(ctx);
-  for (const auto& note : m_before)
-  {
-    auto& n = model.notes.at(note.first);
-    n.setStart(note.second.start());
-    n.setPitch(note.second.pitch());
-  }
+  m_model.find(ctx).notes.update(m_before);
 }
 
 void MoveNotes::redo(const score::DocumentContext& ctx) const
 {
-  auto& model = m_model.find(ctx);
-  for (const auto& note : m_after)
-  {
-    auto& n = model.notes.at(note.first);
-    n.setStart(note.second.start());
-    n.setPitch(note.second.pitch());
-  }
+  m_model.find(ctx).notes.update(m_after);
 }
 
 void MoveNotes::update(unused_t, unused_t, int note_delta, double t_delta)
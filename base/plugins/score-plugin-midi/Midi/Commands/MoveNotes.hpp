@@ -27,6 +27,6 @@ protected:
 
 private:
   Path<ProcessModel> m_model;
-  QVector<QPair<Id<Note>, NoteData>> m_before, m_after;
+  std::vector<std::pair<Id<Note>, NoteData>> m_before, m_after;
 };
 }
@@ -13,31 +13,26 @@ RemoveNotes::RemoveNotes(
     const ProcessModel& model, const std::vector<Id<Note>>& notes)
     : m_model{model}
 {
-  for (auto id : notes)
+  m_notes.reserve(notes.size());
+  for (auto& id : notes)
   {
-    auto& note = model.notes.at(id);
-    m_notes.push_back(qMakePair(
-        id, NoteData{note.start(), note.duration(), note.pitch(),
-                     note.velocity()}));
+    m_notes.push_back({id, model.notes.at(id)});
   }
 }
 
 void RemoveNotes::undo(const score::DocumentContext& ctx) const
 {
-  auto& model = m_model.find(ctx);
-  for (auto& note : m_notes)
-  {
-    model.notes.add(new Note{note.first, note.second, &model});
-  }
+  m_model.find(ctx).notes.add(m_notes);
 }
 
 void RemoveNotes::redo(const score::DocumentContext& ctx) const
 {
-  auto& model = m_model.find(ctx);
+  std::vector<Id<Note>> ids;
+  ids.reserve(m_notes.size());
   for (auto& note : m_notes)
-  {
-    model.notes.remove(note.first);
-  }
+    ids.push_back(note.first);
+
+  m_model.find(ctx).notes.remove(ids);
 }
 
 void RemoveNotes::serializeImpl(DataStreamInput& s) const
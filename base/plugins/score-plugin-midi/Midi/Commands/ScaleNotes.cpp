@@ -18,21 +18,29 @@ ScaleNotes::ScaleNotes(
 void ScaleNotes::undo(const score::DocumentContext& ctx) const
 {
   auto& model = m_model.find(ctx);
+  NoteStore::note_list notes;
+  notes.reserve(m_toScale.size());
   for (auto& note : m_toScale)
   {
-    auto& n = model.notes.at(note);
+    NoteData n = model.notes.at(note);
     n.setDuration(n.duration() - m_delta);
+    notes.push_back({note, n});
   }
+  model.notes.update(notes);
 }
 
 void ScaleNotes::redo(const score::DocumentContext& ctx) const
 {
   auto& model = m_model.find(ctx);
+  NoteStore::note_list notes;
+  notes.reserve(m_toScale.size());
   for (auto& note : m_toScale)
   {
-    auto& n = model.notes.at(note);
+    NoteData n = model.notes.at(note);
     n.setDuration(std::max(n.duration() + m_delta, 0.001));
+    notes.push_back({note, n});
   }
+  model.notes.update(notes);
 }
 
 void ScaleNotes::serializeImpl(DataStreamInput& s) const
@@ -48,29 +56,17 @@ void ScaleNotes::deserializeImpl(DataStreamOutput& s)
 RescaleMidi::RescaleMidi(const ProcessModel& model, double delta)
     : m_model{model}, m_delta{delta}
 {
-  m_old.reserve(model.notes.size());
-  for (auto& note : model.notes)
-    m_old.push_back({note.id(), note.noteData()});
+  m_old = model.notes.list();
 }
 
 void RescaleMidi::undo(const score::DocumentContext& ctx) const
 {
-  auto& model = m_model.find(ctx);
-  model.notes.clear();
-  for (auto& note : m_old)
-  {
-    model.notes.add(new Note{note.first, note.second, &model});
-  }
+  m_model.find(ctx).notes.replace(m_old);
 }
 
 void RescaleMidi::redo(const score::DocumentContext& ctx) const
 {
-  auto& model = m_model.find(ctx);
-  for (auto& note : model.notes)
-  {
-    note.setStart(note.start() * m_delta);
-    note.setDuration(note.duration() * m_delta);
-  }
+  m_model.find(ctx).notes.scale(m_delta);
 }
 
 void RescaleMidi::serializeImpl(DataStreamInput& s) const
@@ -23,65 +23,74 @@ Component::Component(
   m_ossia_process = std::make_shared<midi_node_process>(midi);
 
   midi->set_channel(element.channel());
-  auto set_notes = [&, midi] {
-    midi_node::note_set notes;
-    notes.container.reserve(element.notes.size());
-    for (const auto& n : element.notes)
-    {
-      auto data = n.noteData();
-      if (data.start() < 0 && data.end() > 0)
-      {
-        data.setStart(0.);
-        data.setDuration(data.duration() + data.start());
-      }
-      notes.insert(to_note(data));
-    }
-
-    in_exec([n = std::move(notes), midi]() mutable {
-      midi->set_notes(std::move(n));
-    });
-  };
   set_notes();
 
   element.notes.added.connect<&Component::on_noteAdded>(this);
   element.notes.removing.connect<&Component::on_noteRemoved>(this);
+  element.notes.changed.connect<&Component::on_noteChanged>(this);
+  element.notes.reset.connect<&Component::set_notes>(this);
 
-  for (auto& note : element.notes)
-  {
-    QObject::connect(
-        &note, &Note::noteChanged, this,
-        [&, midi, cur = to_note(note.noteData())]() mutable {
-          auto old = cur;
-          cur = to_note(note.noteData());
-          in_exec([old, cur, midi] { midi->update_note(old, cur); });
-        });
-  }
   QObject::connect(
-      &element, &Midi::ProcessModel::notesChanged, this, set_notes);
+      &element, &Midi::ProcessModel::notesChanged, this,
+      &Component::set_notes);
 }
 
 Component::~Component()
 {
 }
 
-void Component::on_noteAdded(const Note& n)
+void Component::set_notes()
 {
+  // The notes of the model are already sorted by start time
+  // so the set can be built in a single pass.
+  const auto& notes = process().notes;
+  std::vector<NoteData> clipped;
+  clipped.reserve(notes.size());
+  bool reorder = false;
+  for (const auto& n : notes)
+  {
+    auto data = n;
+    if (data.start() < 0 && data.end() > 0)
+    {
+      data.setStart(0.);
+      data.setDuration(data.duration() + n.start());
+      reorder = true;
+    }
+    clipped.push_back(data);
+  }
+  if (reorder)
+    std::stable_sort(clipped.begin(), clipped.end(), NoteComparator{});
+
+  midi_node::note_set set;
+  set.container.reserve(clipped.size());
+  for (const auto& n : clipped)
+    set.container.push_back(to_note(n));
+
   auto midi = std::dynamic_pointer_cast<midi_node>(node);
-  in_exec([nd = to_note(n.noteData()), midi] { midi->add_note(nd); });
+  in_exec([n = std::move(set), midi]() mutable {
+    midi->set_notes(std::move(n));
+  });
+}
 
-  QObject::connect(
-      &n, &Note::noteChanged, this,
-      [&, midi, cur = to_note(n.noteData())]() mutable {
-        auto old = cur;
-        cur = to_note(n.noteData());
-        in_exec([old, cur, midi] { midi->update_note(old, cur); });
-      });
+void Component::on_noteAdded(const Id<Note>&, const NoteData& n)
+{
+  auto midi = std::dynamic_pointer_cast<midi_node>(node);
+  in_exec([nd = to_note(n), midi] { midi->add_note(nd); });
+}
+
+void Component::on_noteRemoved(const Id<Note>&, const NoteData& n)
+{
+  auto midi = std::dynamic_pointer_cast<midi_node>(node);
+  in_exec([nd = to_note(n), midi] { midi->remove_note(nd); });
 }
 
-void Component::on_noteRemoved(const Note& n)
+void Component::on_noteChanged(
+    const Id<Note>&, const NoteData& old, const NoteData& cur)
 {
   auto midi = std::dynamic_pointer_cast<midi_node>(node);
-  in_exec([nd = to_note(n.noteData()), midi] { midi->remove_note(nd); });
+  in_exec([old = to_note(old), cur = to_note(cur), midi] {
+    midi->update_note(old, cur);
+  });
 }
 
 ossia::nodes::note_data Component::to_note(const NoteData& n)
@@ -33,8 +33,10 @@ public:
   ~Component() override;
 
 private:
-  void on_noteAdded(const Midi::Note&);
-  void on_noteRemoved(const Midi::Note&);
+  void set_notes();
+  void on_noteAdded(const Id<Note>&, const NoteData&);
+  void on_noteRemoved(const Id<Note>&, const NoteData&);
+  void on_noteChanged(const Id<Note>&, const NoteData&, const NoteData&);
 
   ossia::nodes::note_data to_note(const NoteData& n);
 };
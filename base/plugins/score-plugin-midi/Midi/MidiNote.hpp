@@ -1,8 +1,7 @@
 #pragma once
-#include <score/model/IdentifiedObject.hpp>
-#include <score/selection/Selectable.hpp>
+#include <score/model/Identifier.hpp>
 
-#include <wobjectdefs.h>
+#include <cstdint>
 
 namespace Midi
 {
@@ -74,82 +73,10 @@ struct NoteComparator
 };
 
 /**
- * @brief The Note class
+ * @brief Tag type for the identifiers of notes.
  *
- * TODO rethink the object model.
- * Add a virtual findChild method to Entity.
- * Remove all uses of NamedObject and add IDs everywhere.
- * Allocate the Notes on a vector<Note> and allow them to be copied.
- * Don't allow signals in some way.
+ * Notes are not objects: they are stored by value in the NoteStore of
+ * their process, and referred to by commands through an Id<Note>.
  */
-class Note final : public IdentifiedObject<Note>
-{
-  W_OBJECT(Note)
-
-public:
-  Selectable selection;
-
-  Note(const Id<Note>& id, QObject* parent);
-  Note(const Id<Note>& id, NoteData n, QObject* parent);
-
-  template <
-      typename DeserializerVisitor,
-      enable_if_deserializer<DeserializerVisitor>* = nullptr>
-  Note(DeserializerVisitor&& vis, QObject* parent)
-      : IdentifiedObject<Note>{vis, parent}
-  {
-    vis.writeTo(*this);
-  }
-
-  // Both are between 0 - 1, 1 being the process duration.
-
-  double start() const noexcept
-  {
-    return m_start;
-  }
-
-  double duration() const noexcept
-  {
-    return m_duration;
-  }
-
-  double end() const noexcept
-  {
-    return m_start + m_duration;
-  }
-
-  midi_size_t pitch() const noexcept
-  {
-    return m_pitch;
-  }
-
-  midi_size_t velocity() const noexcept
-  {
-    return m_velocity;
-  }
-
-  void scale(double s) noexcept;
-
-  void setStart(double s) noexcept;
-
-  void setDuration(double s) noexcept;
-
-  void setPitch(midi_size_t s) noexcept;
-
-  void setVelocity(midi_size_t s) noexcept;
-
-  NoteData noteData() const noexcept;
-
-  void setData(NoteData d) noexcept;
-
-public:
-  void noteChanged() W_SIGNAL(noteChanged);
-
-private:
-  double m_start{};
-  double m_duration{};
-
-  midi_size_t m_pitch{};
-  midi_size_t m_velocity{64};
-};
+class Note;
 }
@@ -0,0 +1,250 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include "MidiNoteStore.hpp"
+
+#include <score/tools/Todo.hpp>
+
+#include <limits>
+#include <numeric>
+
+namespace Midi
+{
+NoteStore::~NoteStore()
+{
+}
+
+bool NoteStore::contains(const Id<Note>& id) const noexcept
+{
+  ensureIndex();
+  return m_index.find(id.val()) != m_index.end();
+}
+
+std::size_t NoteStore::index(const Id<Note>& id) const noexcept
+{
+  ensureIndex();
+  auto it = m_index.find(id.val());
+  SCORE_ASSERT(it != m_index.end());
+  return it->second;
+}
+
+NoteStore::note_list NoteStore::list() const
+{
+  note_list res;
+  res.reserve(m_notes.size());
+  for (std::size_t i = 0; i < m_notes.size(); i++)
+    res.emplace_back(m_ids[i], m_notes[i]);
+  return res;
+}
+
+std::size_t NoteStore::insert_sorted(const Id<Note>& id, const NoteData& n)
+{
+  // Equal start times keep their insertion order
+  auto it = std::upper_bound(
+      m_notes.begin(), m_notes.end(), n.start(),
+      [](double t, const NoteData& other) { return t < other.start(); });
+  const auto pos = std::distance(m_notes.begin(), it);
+
+  m_notes.insert(it, n);
+  m_ids.insert(m_ids.begin() + pos, id);
+  invalidate();
+  return pos;
+}
+
+void NoteStore::add(const Id<Note>& id, const NoteData& n)
+{
+  insert_sorted(id, n);
+  added(id, n);
+}
+
+void NoteStore::add(const note_list& notes)
+{
+  m_notes.reserve(m_notes.size() + notes.size());
+  m_ids.reserve(m_ids.size() + notes.size());
+  for (const auto& [id, n] : notes)
+  {
+    m_notes.push_back(n);
+    m_ids.push_back(id);
+  }
+  sort();
+
+  for (const auto& [id, n] : notes)
+    added(id, n);
+}
+
+void NoteStore::remove(const Id<Note>& id)
+{
+  const auto i = index(id);
+  removing(id, m_notes[i]);
+
+  m_notes.erase(m_notes.begin() + i);
+  m_ids.erase(m_ids.begin() + i);
+  invalidate();
+}
+
+void NoteStore::remove(const std::vector<Id<Note>>& ids)
+{
+  if (ids.empty())
+    return;
+
+  // Mark the notes to remove, then compact both arrays in a single pass
+  std::vector<bool> erased(m_notes.size(), false);
+  for (const auto& id : ids)
+  {
+    const auto i = index(id);
+    removing(id, m_notes[i]);
+    erased[i] = true;
+  }
+
+  std::size_t k = 0;
+  for (std::size_t i = 0; i < m_notes.size(); i++)
+  {
+    if (!erased[i])
+    {
+      m_notes[k] = m_notes[i];
+      m_ids[k] = m_ids[i];
+      k++;
+    }
+  }
+  m_notes.resize(k);
+  m_ids.resize(k);
+  invalidate();
+}
+
+void NoteStore::update(const Id<Note>& id, const NoteData& n)
+{
+  const auto i = index(id);
+  const NoteData old = m_notes[i];
+
+  if (old.start() == n.start())
+  {
+    m_notes[i] = n;
+    invalidate();
+  }
+  else
+  {
+    m_notes.erase(m_notes.begin() + i);
+    m_ids.erase(m_ids.begin() + i);
+    insert_sorted(id, n);
+  }
+
+  changed(id, old, n);
+}
+
+void NoteStore::update(const note_list& notes)
+{
+  if (notes.empty())
+    return;
+
+  note_list old;
+  old.reserve(notes.size());
+
+  for (const auto& [id, n] : notes)
+  {
+    auto& cur = m_notes[index(id)];
+    old.emplace_back(id, cur);
+    cur = n;
+  }
+  sort();
+
+  for (std::size_t i = 0; i < notes.size(); i++)
+    changed(notes[i].first, old[i].second, notes[i].second);
+}
+
+void NoteStore::replace(const note_list& notes)
+{
+  m_notes.clear();
+  m_ids.clear();
+  m_notes.reserve(notes.size());
+  m_ids.reserve(notes.size());
+  for (const auto& [id, n] : notes)
+  {
+    m_notes.push_back(n);
+    m_ids.push_back(id);
+  }
+  sort();
+  reset();
+}
+
+void NoteStore::replace(std::vector<Id<Note>> ids, std::vector<NoteData> notes)
+{
+  SCORE_ASSERT(ids.size() == notes.size());
+  m_ids = std::move(ids);
+  m_notes = std::move(notes);
+  sort();
+  reset();
+}
+
+void NoteStore::scale(double ratio)
+{
+  if (ratio == 1.)
+    return;
+
+  // Scaling by a positive factor keeps the order
+  for (auto& n : m_notes)
+  {
+    n.setStart(n.start() * ratio);
+    n.setDuration(n.duration() * ratio);
+  }
+  invalidate();
+  reset();
+}
+
+void NoteStore::clear()
+{
+  m_notes.clear();
+  m_ids.clear();
+  invalidate();
+  reset();
+}
+
+void NoteStore::sort()
+{
+  invalidate();
+
+  const auto by_start
+      = [](const NoteData& lhs, const NoteData& rhs) {
+          return lhs.start() < rhs.start();
+        };
+  if (std::is_sorted(m_notes.begin(), m_notes.end(), by_start))
+    return;
+
+  std::vector<std::size_t> perm(m_notes.size());
+  std::iota(perm.begin(), perm.end(), 0);
+  std::stable_sort(perm.begin(), perm.end(), [&](auto lhs, auto rhs) {
+    return by_start(m_notes[lhs], m_notes[rhs]);
+  });
+
+  std::vector<NoteData> notes;
+  std::vector<Id<Note>> ids;
+  notes.reserve(perm.size());
+  ids.reserve(perm.size());
+  for (auto i : perm)
+  {
+    notes.push_back(m_notes[i]);
+    ids.push_back(m_ids[i]);
+  }
+  m_notes = std::move(notes);
+  m_ids = std::move(ids);
+}
+
+void NoteStore::ensureIndex() const
+{
+  if (!m_indexDirty)
+    return;
+
+  const std::size_t n = m_notes.size();
+  m_index.clear();
+  m_index.reserve(n);
+  m_maxEnd.resize(n);
+
+  double max_end = std::numeric_limits<double>::lowest();
+  for (std::size_t i = 0; i < n; i++)
+  {
+    m_index[m_ids[i].val()] = i;
+    max_end = std::max(max_end, m_notes[i].end());
+    m_maxEnd[i] = max_end;
+  }
+
+  m_indexDirty = false;
+}
+}
@@ -0,0 +1,144 @@
+#pragma once
+#include <Midi/MidiNote.hpp>
+
+#include <score/tools/std/HashMap.hpp>
+
+#include <nano_signal_slot.hpp>
+#include <score_plugin_midi_export.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace Midi
+{
+/**
+ * @brief Storage of the notes of a MIDI process.
+ *
+ * The notes are kept by value in a contiguous array sorted by start time,
+ * and their identifiers in a parallel array.
+ * This allows files with hundreds of thousands of notes to be loaded
+ * without creating one object per note.
+ *
+ * Lookups by identifier go through a hash map, and time-range queries
+ * through the running maximum of the note ends: both are rebuilt lazily
+ * after a modification, so that batches of edits only pay for it once.
+ */
+class SCORE_PLUGIN_MIDI_EXPORT NoteStore
+{
+public:
+  using value_type = NoteData;
+  using note_list = std::vector<std::pair<Id<Note>, NoteData>>;
+
+  NoteStore() = default;
+  NoteStore(const NoteStore&) = delete;
+  NoteStore& operator=(const NoteStore&) = delete;
+  ~NoteStore();
+
+  auto begin() const noexcept
+  {
+    return m_notes.cbegin();
+  }
+  auto end() const noexcept
+  {
+    return m_notes.cend();
+  }
+  std::size_t size() const noexcept
+  {
+    return m_notes.size();
+  }
+  bool empty() const noexcept
+  {
+    return m_notes.empty();
+  }
+
+  //! Notes, sorted by start time.
+  const std::vector<NoteData>& notes() const noexcept
+  {
+    return m_notes;
+  }
+  //! Identifiers, in the same order than notes().
+  const std::vector<Id<Note>>& ids() const noexcept
+  {
+    return m_ids;
+  }
+
+  const NoteData& operator[](std::size_t i) const noexcept
+  {
+    return m_notes[i];
+  }
+  const Id<Note>& id(std::size_t i) const noexcept
+  {
+    return m_ids[i];
+  }
+
+  bool contains(const Id<Note>& id) const noexcept;
+  std::size_t index(const Id<Note>& id) const noexcept;
+  const NoteData& at(const Id<Note>& id) const noexcept
+  {
+    return m_notes[index(id)];
+  }
+
+  //! Copy of the notes and their identifiers
+  note_list list() const;
+
+  void add(const Id<Note>& id, const NoteData& n);
+  void add(const note_list& notes);
+
+  void remove(const Id<Note>& id);
+  void remove(const std::vector<Id<Note>>& ids);
+
+  void update(const Id<Note>& id, const NoteData& n);
+  void update(const note_list& notes);
+
+  //! Bulk operations: they only send the reset signal.
+  void replace(const note_list& notes);
+  void replace(std::vector<Id<Note>> ids, std::vector<NoteData> notes);
+  void scale(double ratio);
+  void clear();
+
+  /**
+   * @brief Calls f(i) for the index of each note intersecting [start; end].
+   *
+   * Notes are visited in increasing start order.
+   */
+  template <typename F>
+  void visit(double start, double end, F&& f) const
+  {
+    ensureIndex();
+    const auto first_end
+        = std::lower_bound(m_maxEnd.begin(), m_maxEnd.end(), start);
+    const std::size_t n = m_notes.size();
+    for (std::size_t i = first_end - m_maxEnd.begin(); i < n; i++)
+    {
+      const auto& note = m_notes[i];
+      if (note.start() > end)
+        break;
+      if (note.end() >= start)
+        f(i);
+    }
+  }
+
+  mutable Nano::Signal<void(const Id<Note>&, const NoteData&)> added;
+  mutable Nano::Signal<void(const Id<Note>&, const NoteData&)> removing;
+  //! id, previous value, new value
+  mutable Nano::Signal<void(const Id<Note>&, const NoteData&, const NoteData&)>
+      changed;
+  mutable Nano::Signal<void()> reset;
+
+private:
+  std::size_t insert_sorted(const Id<Note>& id, const NoteData& n);
+  void sort();
+  void invalidate() noexcept
+  {
+    m_indexDirty = true;
+  }
+  void ensureIndex() const;
+
+  std::vector<NoteData> m_notes;
+  std::vector<Id<Note>> m_ids;
+
+  mutable score::hash_map<int32_t, std::size_t> m_index;
+  mutable std::vector<double> m_maxEnd;
+  mutable bool m_indexDirty{true};
+};
+}
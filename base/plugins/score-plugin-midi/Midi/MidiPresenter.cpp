@@ -5,7 +5,6 @@
 #include <Midi/Commands/RemoveNotes.hpp>
 #include <Midi/Commands/ScaleNotes.hpp>
 #include <Midi/MidiDrop.hpp>
-#include <Midi/MidiNoteView.hpp>
 #include <Midi/MidiPresenter.hpp>
 #include <Midi/MidiProcess.hpp>
 #include <Midi/MidiView.hpp>
@@ -22,10 +21,6 @@
 
 #include <ossia/detail/math.hpp>
 
-#include <boost/range/adaptor/filtered.hpp>
-#include <boost/range/adaptor/transformed.hpp>
-#include <boost/range/algorithm/copy.hpp>
-
 #include <QAction>
 #include <QApplication>
 #include <QInputDialog>
@@ -50,27 +45,18 @@ Presenter::Presenter(
   auto& model = layer;
 
   con(model, &ProcessModel::notesChanged, this, [&] {
-    for (auto note : m_notes)
-    {
-      delete note;
-    }
-
-    m_notes.clear();
-
-    for (auto& note : model.notes)
-    {
-      on_noteAdded(note);
-    }
+    m_view->setDefaultWidth(m_layer.duration().toPixels(m_zr));
   });
 
   con(model, &ProcessModel::rangeChanged, this, [=](int min, int max) {
     m_view->setRange(min, max);
-    for (auto note : m_notes)
-      updateNote(*note);
   });
   m_view->setRange(model.range().first, model.range().second);
+  m_view->setNotes(model.notes);
   model.notes.added.connect<&Presenter::on_noteAdded>(this);
   model.notes.removing.connect<&Presenter::on_noteRemoving>(this);
+  model.notes.changed.connect<&Presenter::on_noteChanged>(this);
+  model.notes.reset.connect<&Presenter::on_notesReset>(this);
 
   connect(m_view, &View::doubleClicked, this, [&](QPointF pos) {
     CommandDispatcher<>{context().context.commandStack}.submit(
@@ -87,13 +73,18 @@ Presenter::Presenter(
         new RemoveNotes{m_layer, selectedNotes()});
   });
 
+  connect(m_view, &View::notesMoved, this, [&](int pitch, double time) {
+    m_ongoing.submit(m_layer, selectedNotes(), pitch, time);
+    m_ongoing.commit();
+  });
+
+  connect(m_view, &View::notesScaled, this, [&](double duration) {
+    CommandDispatcher<>{context().context.commandStack}.submit(
+        new ScaleNotes{m_layer, selectedNotes(), duration});
+  });
+
   connect(
       m_view, &View::askContextMenu, this, &Presenter::contextMenuRequested);
-
-  for (auto& note : model.notes)
-  {
-    on_noteAdded(note);
-  }
 #if __has_include(<valgrind/callgrind.h>)
   // CALLGRIND_START_INSTRUMENTATION;
 #endif
@@ -148,15 +139,11 @@ void Presenter::setWidth(qreal val)
 {
   m_view->setWidth(val);
   m_view->setDefaultWidth(m_layer.duration().toPixels(m_zr));
-  for (auto note : m_notes)
-    updateNote(*note);
 }
 
 void Presenter::setHeight(qreal val)
 {
   m_view->setHeight(val);
-  for (auto note : m_notes)
-    updateNote(*note);
 }
 
 void Presenter::putToFront()
@@ -173,8 +160,6 @@ void Presenter::on_zoomRatioChanged(ZoomRatio zr)
 {
   m_zr = zr;
   m_view->setDefaultWidth(m_layer.duration().toPixels(m_zr));
-  for (auto note : m_notes)
-    updateNote(*note);
 }
 
 void Presenter::parentGeometryChanged()
@@ -191,78 +176,28 @@ const Id<Process::ProcessModel>& Presenter::modelId() const
   return m_layer.id();
 }
 
-void Presenter::setupNote(NoteView& v)
+void Presenter::on_noteAdded(const Id<Note>&, const NoteData& n)
 {
-  con(v.note, &Note::noteChanged, &v, [&] { updateNote(v); });
-
-  con(v, &NoteView::noteChangeFinished, this, [&] {
-    const auto [min, max] = this->m_layer.range();
-    auto newPos = v.pos();
-    auto rect = m_view->boundingRect();
-    auto height = rect.height();
-
-    // Snap to grid : we round y to the closest multiple of 127
-    int note = ossia::clamp(
-        int(max
-            - (qMin(rect.bottom(), qMax(newPos.y(), rect.top())) / height)
-                  * this->m_view->visibleCount()),
-        min, max);
-
-    auto notes = selectedNotes();
-    auto it = ossia::find(notes, v.note.id());
-    if (it == notes.end())
-    {
-      notes = {v.note.id()};
-    }
-
-    m_ongoing.submit(
-        m_layer, notes, note - v.note.pitch(),
-        newPos.x() / m_view->defaultWidth() - v.note.start());
-    m_ongoing.commit();
-  });
-
-  con(v, &NoteView::noteScaled, this, [&](double newScale) {
-    auto notes = selectedNotes();
-    auto it = ossia::find(notes, v.note.id());
-    if (it == notes.end())
-    {
-      notes = {v.note.id()};
-    }
-
-    auto dt = newScale - v.note.duration();
-    CommandDispatcher<>{context().context.commandStack}.submit(
-        new ScaleNotes{m_layer, notes, dt});
-  });
+  m_view->updateNote(n);
 }
 
-void Presenter::updateNote(NoteView& v)
+void Presenter::on_noteRemoving(const Id<Note>& id, const NoteData& n)
 {
-  const auto noteRect = v.computeRect();
-  const auto newPos = noteRect.topLeft();
-  if (newPos != v.pos())
-    v.setPos(newPos);
-
-  v.setWidth(noteRect.width());
-  v.setHeight(noteRect.height());
+  m_view->unselect(id);
+  m_view->updateNote(n);
 }
 
-void Presenter::on_noteAdded(const Note& n)
+void Presenter::on_noteChanged(
+    const Id<Note>&, const NoteData& old, const NoteData& n)
 {
-  auto v = new NoteView{n, m_view};
-  setupNote(*v);
-  updateNote(*v);
-  m_notes.push_back(v);
+  m_view->updateNote(old);
+  m_view->updateNote(n);
 }
 
-void Presenter::on_noteRemoving(const Note& n)
+void Presenter::on_notesReset()
 {
-  auto it = ossia::find_if(
-      m_notes, [&](const auto& other) { return &other->note == &n; });
-  if (it != m_notes.end())
-  {
-    delete *it;
-    m_notes.erase(it);
-  }
+  m_view->clearSelection();
+  m_view->update();
 }
 
 void Presenter::on_drop(const QPointF& pos, const QMimeData& md)
@@ -292,13 +227,6 @@ void Presenter::on_drop(const QPointF& pos, const QMimeData& md)
 
 std::vector<Id<Note>> Presenter::selectedNotes() const
 {
-  using namespace boost::adaptors;
-
-  std::vector<Id<Note>> res;
-  boost::copy(
-      m_notes | filtered([](NoteView* v) { return v->isSelected(); })
-          | transformed([](NoteView* v) { return v->note.id(); }),
-      std::back_inserter(res));
-  return res;
+  return m_view->selectedNotes();
 }
 }
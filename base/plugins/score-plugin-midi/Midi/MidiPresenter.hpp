@@ -9,9 +9,7 @@
 class QMimeData;
 namespace Midi
 {
-class NoteView;
 class View;
-class Note;
 class Presenter final : public Process::LayerPresenter, public Nano::Observer
 {
 public:
@@ -34,17 +32,16 @@ public:
   const Id<Process::ProcessModel>& modelId() const override;
 
 private:
-  void setupNote(NoteView&);
-  void updateNote(NoteView&);
-  void on_noteAdded(const Note&);
-  void on_noteRemoving(const Note&);
+  void on_noteAdded(const Id<Note>&, const NoteData&);
+  void on_noteRemoving(const Id<Note>&, const NoteData&);
+  void on_noteChanged(const Id<Note>&, const NoteData&, const NoteData&);
+  void on_notesReset();
   void on_drop(const QPointF& pos, const QMimeData&);
 
   std::vector<Id<Note>> selectedNotes() const;
 
   const Midi::ProcessModel& m_layer;
   View* m_view{};
-  std::vector<NoteView*> m_notes;
 
   SingleOngoingCommandDispatcher<MoveNotes> m_ongoing;
   ZoomRatio m_zr{};
@@ -81,11 +81,8 @@ void ProcessModel::setDurationAndGrow(const TimeVal& newDuration) noexcept
 {
   auto ratio = duration() / newDuration;
 
-  for (auto& note : notes)
-    note.scale(ratio);
-
   setDuration(newDuration);
-  notesChanged();
+  notes.scale(ratio);
 }
 
 void ProcessModel::setDurationAndShrink(const TimeVal& newDuration) noexcept
@@ -93,25 +90,24 @@ void ProcessModel::setDurationAndShrink(const TimeVal& newDuration) noexcept
   auto ratio = duration() / newDuration;
   auto inv_ratio = newDuration / duration();
 
-  std::vector<Id<Note>> toErase;
-  for (Note& n : notes)
+  std::vector<Id<Note>> ids;
+  std::vector<NoteData> kept;
+  ids.reserve(notes.size());
+  kept.reserve(notes.size());
+  for (std::size_t i = 0; i < notes.size(); i++)
   {
-    if (n.end() >= inv_ratio)
-    {
-      toErase.push_back(n.id());
-    }
-    else
+    NoteData n = notes[i];
+    if (n.end() < inv_ratio)
     {
-      n.scale(ratio);
+      n.setStart(n.start() * ratio);
+      n.setDuration(n.duration() * ratio);
+      ids.push_back(notes.id(i));
+      kept.push_back(n);
     }
   }
 
-  for (auto& note : toErase)
-  {
-    notes.remove(note);
-  }
   setDuration(newDuration);
-  notesChanged();
+  notes.replace(std::move(ids), std::move(kept));
 }
 }
 
@@ -145,48 +141,24 @@ void JSONObjectWriter::write(Midi::NoteData& n)
   n.m_velocity = obj["Velocity"].toInt();
 }
 
-template <>
-void DataStreamReader::read(const Midi::Note& n)
-{
-  m_stream << n.noteData();
-  insertDelimiter();
-}
-
-template <>
-void DataStreamWriter::write(Midi::Note& n)
-{
-  Midi::NoteData d;
-  m_stream >> d;
-  n.setData(d);
-  checkDelimiter();
-}
-
-template <>
-void JSONObjectReader::read(const Midi::Note& n)
-{
-  readFrom(n.noteData());
-}
-
-template <>
-void JSONObjectWriter::write(Midi::Note& n)
-{
-  Midi::NoteData d;
-  writeTo(d);
-  n.setData(d);
-}
-
 template <>
 void DataStreamReader::read(const Midi::ProcessModel& proc)
 {
   m_stream << *proc.outlet << proc.channel() << proc.m_range.first
            << proc.m_range.second;
 
+  // Same layout than when notes were serialized as objects
   const auto& notes = proc.notes;
-
   m_stream << (int32_t)notes.size();
-  for (const auto& n : notes)
+  for (std::size_t i = 0; i < notes.size(); i++)
   {
-    readFrom(n);
+    SCORE_DEBUG_INSERT_DELIMITER2(*this);
+    m_stream << QStringLiteral("Note");
+    SCORE_DEBUG_INSERT_DELIMITER2(*this);
+    readFrom(notes.id(i));
+    SCORE_DEBUG_INSERT_DELIMITER2(*this);
+    m_stream << notes[i];
+    insertDelimiter();
   }
 
   insertDelimiter();
@@ -197,12 +169,22 @@ void DataStreamWriter::write(Midi::ProcessModel& proc)
 {
   proc.outlet = Process::make_outlet(*this, &proc);
   m_stream >> proc.m_channel >> proc.m_range.first >> proc.m_range.second;
-  int n;
+  int32_t n{};
   m_stream >> n;
-  for (int i = 0; i < n; i++)
+  std::vector<Id<Midi::Note>> ids(n);
+  std::vector<Midi::NoteData> notes(n);
+  for (int32_t i = 0; i < n; i++)
   {
-    proc.notes.add(new Midi::Note{*this, &proc});
+    QString name;
+    SCORE_DEBUG_CHECK_DELIMITER2(*this);
+    m_stream >> name;
+    SCORE_DEBUG_CHECK_DELIMITER2(*this);
+    writeTo(ids[i]);
+    SCORE_DEBUG_CHECK_DELIMITER2(*this);
+    m_stream >> notes[i];
+    checkDelimiter();
   }
+  proc.notes.replace(std::move(ids), std::move(notes));
   checkDelimiter();
 }
 
@@ -213,7 +195,18 @@ void JSONObjectReader::read(const Midi::ProcessModel& proc)
   obj["Channel"] = proc.channel();
   obj["Min"] = proc.range().first;
   obj["Max"] = proc.range().second;
-  obj["Notes"] = toJsonArray(proc.notes);
+
+  // Same layout than when notes were serialized as objects
+  const auto& notes = proc.notes;
+  QJsonArray arr;
+  for (std::size_t i = 0; i < notes.size(); i++)
+  {
+    QJsonObject note = toJsonObject(notes[i]);
+    note[strings.ObjectName] = QStringLiteral("Note");
+    note[strings.id] = notes.id(i).val();
+    arr.push_back(std::move(note));
+  }
+  obj["Notes"] = std::move(arr);
 }
 
 template <>
@@ -231,11 +224,19 @@ void JSONObjectWriter::write(Midi::ProcessModel& proc)
     }
   }
 
-  for (const auto& json_vref : obj["Notes"].toArray())
   {
-    auto note = new Midi::Note{JSONObject::Deserializer{json_vref.toObject()},
-                               &proc};
-    proc.notes.add(note);
+    const auto arr = obj["Notes"].toArray();
+    std::vector<Id<Midi::Note>> ids;
+    std::vector<Midi::NoteData> notes;
+    ids.reserve(arr.size());
+    notes.reserve(arr.size());
+    for (const auto& json_vref : arr)
+    {
+      const auto note = json_vref.toObject();
+      ids.emplace_back(note[strings.id].toInt());
+      notes.push_back(fromJsonObject<Midi::NoteData>(note));
+    }
+    proc.notes.replace(std::move(ids), std::move(notes));
   }
 
   proc.setChannel(obj["Channel"].toInt());
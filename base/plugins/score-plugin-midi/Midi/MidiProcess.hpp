@@ -1,5 +1,5 @@
 #pragma once
-#include <Midi/MidiNote.hpp>
+#include <Midi/MidiNoteStore.hpp>
 #include <Midi/MidiProcessMetadata.hpp>
 #include <Process/Process.hpp>
 
@@ -37,7 +37,7 @@ public:
 
   ~ProcessModel() override;
 
-  score::EntityMap<Note> notes;
+  NoteStore notes;
 
   void setChannel(int n);
   int channel() const;
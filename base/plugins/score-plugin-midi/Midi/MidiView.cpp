@@ -8,11 +8,14 @@
 
 #include <QGraphicsScene>
 #include <QGraphicsSceneContextMenuEvent>
+#include <QGraphicsSceneHoverEvent>
 #include <QGraphicsSceneMouseEvent>
 #include <QGraphicsView>
 #include <QKeyEvent>
 #include <QPainter>
 
+#include <cmath>
+
 #include <wobjectimpl.h>
 W_OBJECT_IMPL(Midi::View)
 namespace Midi
@@ -141,8 +144,6 @@ void View::setDefaultWidth(double w)
 {
   m_defaultW = w;
   update();
-  for (auto cld : childItems())
-    cld->update();
 }
 
 void View::setRange(int min, int max)
@@ -152,6 +153,123 @@ void View::setRange(int min, int max)
   update();
 }
 
+void View::setNotes(const NoteStore& notes)
+{
+  m_notes = &notes;
+  update();
+}
+
+QRectF View::noteRect(const NoteData& note) const noexcept
+{
+  const auto h = height();
+  const auto note_height = h / visibleCount();
+  return {note.start() * m_defaultW,
+          h - std::ceil((note.pitch() - m_min + 1) * note_height),
+          note.duration() * m_defaultW, note_height};
+}
+
+void View::updateNote(const NoteData& note)
+{
+  // Account for the pen width and the minimal width of the notes
+  update(noteRect(note).adjusted(-2., -2., 2., 2.));
+}
+
+bool View::isSelected(const Id<Note>& note) const noexcept
+{
+  return m_selection.find(note.val()) != m_selection.end();
+}
+
+std::vector<Id<Note>> View::selectedNotes() const
+{
+  std::vector<Id<Note>> res;
+  if (!m_notes)
+    return res;
+
+  res.reserve(m_selection.size());
+  for (int32_t id : m_selection)
+  {
+    Id<Note> note{id};
+    if (m_notes->contains(note))
+      res.push_back(std::move(note));
+  }
+  return res;
+}
+
+void View::unselect(const Id<Note>& note)
+{
+  m_selection.erase(note.val());
+}
+
+void View::clearSelection()
+{
+  if (!m_selection.empty())
+  {
+    m_selection.clear();
+    update();
+  }
+}
+
+QRectF View::visibleRect() const
+{
+  const auto rect = boundingRect();
+  if (auto v = getView(*this))
+  {
+    const auto scene_rect
+        = v->mapToScene(v->viewport()->rect()).boundingRect();
+    return mapRectFromScene(scene_rect).intersected(rect);
+  }
+  return rect;
+}
+
+optional<std::size_t> View::noteAt(QPointF pos) const
+{
+  if (!m_notes || m_defaultW <= 0.)
+    return {};
+
+  // Notes are at least a few pixels wide when hit-testing
+  static constexpr double min_width = 3.;
+  optional<std::size_t> res;
+  const double t = pos.x() / m_defaultW;
+  m_notes->visit(t - min_width / m_defaultW, t, [&](std::size_t i) {
+    const auto& note = (*m_notes)[i];
+    if (note.pitch() < m_min || note.pitch() > m_max)
+      return;
+
+    auto rect = noteRect(note);
+    rect.setWidth(std::max(rect.width(), min_width));
+    if (rect.contains(pos))
+    {
+      // Selected notes are drawn on top so they are picked first
+      if (!res || isSelected(m_notes->id(i))
+          || !isSelected(m_notes->id(*res)))
+        res = i;
+    }
+  });
+  return res;
+}
+
+bool View::onScaleHandle(std::size_t note, QPointF pos) const noexcept
+{
+  const auto rect = noteRect((*m_notes)[note]);
+  return rect.width() > 4. && pos.x() >= rect.right() - 2.;
+}
+
+void View::selectInArea(const QRectF& area)
+{
+  m_selection.clear();
+  if (!m_notes || m_defaultW <= 0.)
+    return;
+
+  const auto r = area.normalized();
+  m_notes->visit(r.left() / m_defaultW, r.right() / m_defaultW, [&](std::size_t i) {
+    const auto& note = (*m_notes)[i];
+    if (note.pitch() < m_min || note.pitch() > m_max)
+      return;
+    if (noteRect(note).intersects(r))
+      m_selection.insert(m_notes->id(i).val());
+  });
+}
+
 bool View::canEdit() const
 {
   const auto rect = boundingRect();
@@ -168,6 +286,9 @@ void View::paint_impl(QPainter* p) const
 
     p->drawPixmap(left, 0, m_bgCache);
   }
+
+  paintNotes(p);
+
   if (!m_selectArea.isEmpty())
   {
     p->setBrush(style.transparentBrush);
@@ -176,17 +297,152 @@ void View::paint_impl(QPainter* p) const
   }
 }
 
+void View::paintNotes(QPainter* p) const
+{
+  if (!m_notes || m_notes->empty() || m_defaultW <= 0.)
+    return;
+
+  const auto visible = visibleRect();
+  if (visible.isEmpty())
+    return;
+
+  const double note_height = height() / visibleCount();
+  const bool drag = m_interaction == Interaction::Move
+                    || m_interaction == Interaction::Scale;
+
+  // Notes are gathered in batches so that each kind of shape is drawn
+  // in a single call ; selected notes are drawn last to be on top.
+  std::vector<QRectF> rects, selected_rects;
+  std::vector<QLineF> lines, selected_lines;
+  std::vector<std::size_t> velocities;
+
+  const double margin = std::abs(m_dragX) + 2.;
+  m_notes->visit(
+      (visible.left() - margin) / m_defaultW,
+      (visible.right() + margin) / m_defaultW, [&](std::size_t i) {
+        const auto& note = (*m_notes)[i];
+        const bool sel = isSelected(m_notes->id(i));
+        QRectF rect = noteRect(note);
+        if (sel && drag)
+        {
+          if (m_interaction == Interaction::Move)
+            rect.translate(m_dragX, -m_dragPitch * note_height);
+          else
+            rect.setWidth(std::max(2., rect.width() + m_dragX));
+        }
+
+        if (!rect.intersects(visible.adjusted(-2., -2., 2., 2.)))
+          return;
+
+        if (rect.width() <= 1.2)
+        {
+          (sel ? selected_lines : lines)
+              .emplace_back(
+                  rect.left(), rect.top(), rect.left(),
+                  rect.bottom() - 1.5);
+        }
+        else
+        {
+          (sel ? selected_rects : rects)
+              .push_back(rect.adjusted(0., 0., 0., -1.5));
+          if (note_height > 8 && rect.width() > 4)
+            velocities.push_back(i);
+        }
+      });
+
+  p->setRenderHint(QPainter::Antialiasing, false);
+  p->setPen(style.noteBasePen);
+
+  p->setBrush(style.noteBaseBrush);
+  p->drawRects(rects.data(), int(rects.size()));
+  p->drawLines(lines.data(), int(lines.size()));
+
+  p->setBrush(style.noteSelectedBaseBrush);
+  p->drawRects(selected_rects.data(), int(selected_rects.size()));
+  p->drawLines(selected_lines.data(), int(selected_lines.size()));
+
+  if (!velocities.empty())
+  {
+    QPen pen = style.paintedNote;
+    for (std::size_t i : velocities)
+    {
+      const auto& note = (*m_notes)[i];
+      QRectF rect = noteRect(note);
+      if (drag && isSelected(m_notes->id(i)))
+      {
+        if (m_interaction == Interaction::Move)
+          rect.translate(m_dragX, -m_dragPitch * note_height);
+        else
+          rect.setWidth(std::max(2., rect.width() + m_dragX));
+      }
+
+      auto orange = style.noteBaseBrush.color();
+      orange.setHslF(
+          orange.hslHueF() - 0.02, 1.,
+          0.25 + (127. - note.velocity()) / 256.);
+      pen.setColor(orange);
+      p->setPen(pen);
+
+      const double y = rect.top() + note_height / 2.;
+      p->drawLine(
+          QPointF{rect.left() + 2., y}, QPointF{rect.right() - 2., y});
+    }
+  }
+}
+
 void View::contextMenuEvent(QGraphicsSceneContextMenuEvent* event)
 {
   askContextMenu(event->screenPos(), event->scenePos());
   event->accept();
 }
 
+void View::hoverMoveEvent(QGraphicsSceneHoverEvent* event)
+{
+  const auto note = canEdit() ? noteAt(event->pos()) : optional<std::size_t>{};
+  if (note && onScaleHandle(*note, event->pos()))
+    setCursor(Qt::SplitHCursor);
+  else
+    setCursor(Qt::ArrowCursor);
+
+  Process::LayerView::hoverMoveEvent(event);
+}
+
 void View::mousePressEvent(QGraphicsSceneMouseEvent* ev)
 {
   if (canEdit())
   {
     pressed(ev->scenePos());
+
+    m_pressPos = ev->pos();
+    m_dragX = 0.;
+    m_dragPitch = 0;
+
+    const bool toggle = ev->modifiers() & Qt::ControlModifier;
+    if (auto note = noteAt(ev->pos()))
+    {
+      const auto& id = m_notes->id(*note);
+      if (toggle && isSelected(id))
+      {
+        m_selection.erase(id.val());
+        m_interaction = Interaction::None;
+      }
+      else
+      {
+        if (!toggle && !isSelected(id))
+          m_selection.clear();
+        m_selection.insert(id.val());
+
+        m_interaction = onScaleHandle(*note, ev->pos()) ? Interaction::Scale
+                                                        : Interaction::Move;
+      }
+    }
+    else
+    {
+      if (!toggle)
+        m_selection.clear();
+      m_interaction = Interaction::Select;
+    }
+    update();
   }
   ev->accept();
 }
@@ -195,12 +451,36 @@ void View::mouseMoveEvent(QGraphicsSceneMouseEvent* ev)
 {
   if (canEdit())
   {
-    QPainterPath p;
-    p.addRect(QRectF{ev->buttonDownPos(Qt::LeftButton), ev->pos()});
-    this->scene()->setSelectionArea(mapToScene(p));
+    switch (m_interaction)
+    {
+      case Interaction::Select:
+      {
+        QPainterPath p;
+        p.addRect(QRectF{m_pressPos, ev->pos()});
+        selectInArea(p.boundingRect());
 
-    m_selectArea = p;
-    update();
+        m_selectArea = p;
+        update();
+        break;
+      }
+      case Interaction::Move:
+      {
+        const auto delta = ev->pos() - m_pressPos;
+        const auto note_height = height() / visibleCount();
+        m_dragX = std::max(delta.x(), -m_pressPos.x());
+        m_dragPitch = qRound(-delta.y() / note_height);
+        update();
+        break;
+      }
+      case Interaction::Scale:
+      {
+        m_dragX = ev->pos().x() - m_pressPos.x();
+        update();
+        break;
+      }
+      default:
+        break;
+    }
   }
   ev->accept();
 }
@@ -209,8 +489,29 @@ void View::mouseReleaseEvent(QGraphicsSceneMouseEvent* ev)
 {
   if (canEdit())
   {
+    const auto interaction = m_interaction;
+    const auto dx = m_dragX;
+    const auto dp = m_dragPitch;
+
+    m_interaction = Interaction::None;
     m_selectArea = {};
+    m_dragX = 0.;
+    m_dragPitch = 0;
     update();
+
+    switch (interaction)
+    {
+      case Interaction::Move:
+        if (dx != 0. || dp != 0)
+          notesMoved(dp, dx / m_defaultW);
+        break;
+      case Interaction::Scale:
+        if (dx != 0.)
+          notesScaled(dx / m_defaultW);
+        break;
+      default:
+        break;
+    }
   }
   ev->accept();
 }
@@ -2,13 +2,22 @@
 #include <Midi/MidiProcess.hpp>
 #include <Process/LayerView.hpp>
 
+#include <score/tools/std/Optional.hpp>
+
 #include <QPainterPath>
 
+#include <tsl/hopscotch_set.h>
 #include <wobjectdefs.h>
 
 namespace Midi
 {
-class NoteView;
+/**
+ * @brief The piano roll.
+ *
+ * Notes do not have an item of their own: the view paints the notes
+ * intersecting the visible area straight from the NoteStore of the process,
+ * and handles the selection, move and resize of notes by hit-testing it.
+ */
 class View final : public Process::LayerView
 {
   W_OBJECT(View)
@@ -30,15 +39,43 @@ public:
   NoteData noteAtPos(QPointF point) const;
   int visibleCount() const;
 
+  void setNotes(const NoteStore& notes);
+  QRectF noteRect(const NoteData& note) const noexcept;
+  void updateNote(const NoteData& note);
+
+  std::vector<Id<Note>> selectedNotes() const;
+  void unselect(const Id<Note>& note);
+  void clearSelection();
+
 public:
   void deleteRequested() W_SIGNAL(deleteRequested);
+  void notesMoved(int pitch, double time)
+      W_SIGNAL(notesMoved, pitch, time); // time is scaled between [0; 1]
+  void notesScaled(double duration)
+      W_SIGNAL(notesScaled, duration); // scaled between [0; 1]
 
 private:
+  enum class Interaction
+  {
+    None,
+    Select,
+    Move,
+    Scale
+  };
+
   bool canEdit() const;
+  QRectF visibleRect() const;
+  optional<std::size_t> noteAt(QPointF pos) const;
+  bool isSelected(const Id<Note>& note) const noexcept;
+  bool onScaleHandle(std::size_t note, QPointF pos) const noexcept;
+  void selectInArea(const QRectF& area);
+  void paintNotes(QPainter*) const;
+
   void paint_impl(QPainter*) const override;
   void heightChanged(qreal h) override;
   void widthChanged(qreal w) override;
   void contextMenuEvent(QGraphicsSceneContextMenuEvent* event) override;
+  void hoverMoveEvent(QGraphicsSceneHoverEvent* event) override;
   void mousePressEvent(QGraphicsSceneMouseEvent*) override;
   void mouseMoveEvent(QGraphicsSceneMouseEvent*) override;
   void mouseReleaseEvent(QGraphicsSceneMouseEvent*) override;
@@ -46,8 +83,16 @@ private:
   void keyPressEvent(QKeyEvent*) override;
   void dropEvent(QGraphicsSceneDragDropEvent* event) override;
 
+  const NoteStore* m_notes{};
+  tsl::hopscotch_set<int32_t> m_selection;
+
+  Interaction m_interaction{Interaction::None};
+  QPointF m_pressPos;
+  double m_dragX{};
+  int m_dragPitch{};
+
   QPainterPath m_selectArea;
-  double m_defaultW; // Covers the [ 0; 1 ] area
+  double m_defaultW{}; // Covers the [ 0; 1 ] area
   int m_min{0}, m_max{127};
 
   QPixmap m_bgCache;
@@ -0,0 +1,67 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include "CaptureQueue.hpp"
+
+#include <algorithm>
+
+namespace Recording
+{
+namespace
+{
+struct CaptureVisitor
+{
+  std::array<float, 4>& res;
+
+  template <std::size_t N>
+  bool operator()(const std::array<float, N>& v) const noexcept
+  {
+    std::copy_n(v.begin(), N, res.begin());
+    return true;
+  }
+
+  bool operator()(float f) const noexcept
+  {
+    res[0] = f;
+    return true;
+  }
+  bool operator()(int f) const noexcept
+  {
+    res[0] = f;
+    return true;
+  }
+  bool operator()(char f) const noexcept
+  {
+    res[0] = f;
+    return true;
+  }
+  bool operator()(bool f) const noexcept
+  {
+    res[0] = f;
+    return true;
+  }
+
+  template <typename... T>
+  bool operator()(const T&...) const noexcept
+  {
+    return false;
+  }
+};
+}
+
+void CaptureQueue::drain(std::vector<CapturedValue>& out)
+{
+  out.clear();
+  CapturedValue v;
+  while (values.try_dequeue(v))
+    out.push_back(v);
+
+  std::stable_sort(
+      out.begin(), out.end(),
+      [](const auto& lhs, const auto& rhs) { return lhs.time < rhs.time; });
+}
+
+bool toCapturedValue(const ossia::value& val, CapturedValue& res) noexcept
+{
+  return val.apply(CaptureVisitor{res.value});
+}
+}
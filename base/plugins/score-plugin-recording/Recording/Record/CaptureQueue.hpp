@@ -0,0 +1,63 @@
+#pragma once
+#include <ossia/network/value/value.hpp>
+
+#include <concurrentqueue.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace Recording
+{
+struct RecordData;
+
+/**
+ * @brief A value received on a recorded address
+ *
+ * The time is taken as soon as the value is received by the protocol,
+ * not when it reaches the GUI.
+ */
+struct CapturedValue
+{
+  std::chrono::steady_clock::time_point time;
+  std::array<float, 4> value{};
+};
+
+/**
+ * @brief Values received on a recorded address and not yet in the curves
+ *
+ * Filled from the threads of the protocol, and emptied periodically on the
+ * GUI thread, which adds the points to the curves in batches.
+ * A protocol may call the callback of an address from several threads
+ * (e.g. the WebSocket and UDP threads of OSCQuery, and the GUI), hence
+ * the multiple-producer queue.
+ * It grows if needed so that no value is lost.
+ */
+struct CaptureQueue
+{
+  //! A second of a 1 kHz stream
+  static constexpr std::size_t initial_size = 1024;
+
+  CaptureQueue(const RecordData* d, int n) noexcept : data{d}, components{n}
+  {
+  }
+
+  //! Moves the values in the queue to out, sorted by time: the values of
+  //! different producers are not dequeued in order.
+  void drain(std::vector<CapturedValue>& out);
+
+  moodycamel::ConcurrentQueue<CapturedValue> values{initial_size};
+
+  //! The curves of each component of the address
+  const RecordData* data{};
+  int components{};
+};
+
+/**
+ * @brief Converts a value to its numeric components
+ *
+ * Returns false if the value cannot be recorded as an automation.
+ */
+bool toCapturedValue(const ossia::value& val, CapturedValue& res) noexcept;
+}
@@ -56,7 +56,8 @@ void RecordAutomationCreationVisitor::handle_numeric(float val)
 {
   addresses.back().push_back(Device::address(node).address);
   recorder.numeric_records.insert(
-      std::make_pair(addresses.back().back(), makeCurve(val)));
+      std::make_pair(
+          State::InternedAddress{addresses.back().back()}, makeCurve(val)));
 }
 
 void RecordAutomationCreationVisitor::operator()(std::array<float, 2> val)
@@ -66,7 +67,7 @@ void RecordAutomationCreationVisitor::operator()(std::array<float, 2> val)
   // The address is added only once
   addresses.back().push_back(Device::address(node).address);
   recorder.vec2_records.insert(std::make_pair(
-      addresses.back().back(),
+      State::InternedAddress{addresses.back().back()},
       std::array<RecordData, 2>{makeCurve(val[0]), makeCurve(val[1])}));
 }
 
@@ -77,7 +78,7 @@ void RecordAutomationCreationVisitor::operator()(std::array<float, 3> val)
   // The address is added only once
   addresses.back().push_back(Device::address(node).address);
   recorder.vec3_records.insert(std::make_pair(
-      addresses.back().back(),
+      State::InternedAddress{addresses.back().back()},
       std::array<RecordData, 3>{makeCurve(val[0]), makeCurve(val[1]),
                                 makeCurve(val[2])}));
 }
@@ -89,7 +90,7 @@ void RecordAutomationCreationVisitor::operator()(std::array<float, 4> val)
   // The address is added only once
   addresses.back().push_back(Device::address(node).address);
   recorder.vec4_records.insert(std::make_pair(
-      addresses.back().back(),
+      State::InternedAddress{addresses.back().back()},
       std::array<RecordData, 4>{makeCurve(val[0]), makeCurve(val[1]),
                                 makeCurve(val[2]), makeCurve(val[3])}));
 }
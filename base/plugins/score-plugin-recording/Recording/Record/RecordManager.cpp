@@ -19,7 +19,6 @@
 #include <Process/TimeValue.hpp>
 #include <Recording/Commands/Record.hpp>
 #include <Recording/Record/RecordAutomations/RecordAutomationCreationVisitor.hpp>
-#include <Recording/Record/RecordAutomations/RecordAutomationFirstParameterCallbackVisitor.hpp>
 #include <Recording/Record/RecordAutomations/RecordAutomationParameterCallbackVisitor.hpp>
 #include <Recording/Record/RecordData.hpp>
 #include <Recording/Record/RecordManager.hpp>
@@ -91,11 +90,26 @@ bool AutomationRecorder::setup(
     }
   }
 
+  //// Queues in which the values are captured ////
+  for (const auto& p : numeric_records)
+    m_captures.insert(
+        {p.first, std::make_unique<CaptureQueue>(&p.second, 1)});
+  for (const auto& p : vec2_records)
+    m_captures.insert(
+        {p.first, std::make_unique<CaptureQueue>(p.second.data(), 2)});
+  for (const auto& p : vec3_records)
+    m_captures.insert(
+        {p.first, std::make_unique<CaptureQueue>(p.second.data(), 3)});
+  for (const auto& p : vec4_records)
+    m_captures.insert(
+        {p.first, std::make_unique<CaptureQueue>(p.second.data(), 4)});
+
+  connect(&context.timer, &QTimer::timeout, this, &AutomationRecorder::flush);
+
   const auto& devicelist = context.explorer.deviceModel().list();
 
   //// Setup listening on the curves ////
-  const auto curve_mode = m_settings.getCurveMode();
-  m_recordingMode = curve_mode;
+  m_recordingMode = m_settings.getCurveMode();
   int i = 0;
   for (const auto& vec : recordListening)
   {
@@ -105,14 +119,8 @@ bool AutomationRecorder::setup(
 
     dev.addToListening(addresses[i]);
     // Add a custom callback.
-    if (curve_mode == Curve::Settings::Mode::Parameter)
-    {
-      dev.valueUpdated.connect<&AutomationRecorder::parameterCallback>(*this);
-    }
-    else
-    {
-      dev.valueUpdated.connect<&AutomationRecorder::messageCallback>(*this);
-    }
+    dev.internedValueUpdated.connect<&AutomationRecorder::captureCallback>(
+        *this);
 
     m_recordCallbackConnections.push_back(&dev);
 
@@ -126,21 +134,12 @@ void AutomationRecorder::stop()
 {
   // Stop all the recording machinery
   auto msecs = context.time();
-  const auto curve_mode = m_recordingMode;
   for (const auto& dev : m_recordCallbackConnections)
   {
     if (dev)
     {
-      if (curve_mode == Curve::Settings::Mode::Parameter)
-      {
-        dev->valueUpdated.disconnect<&AutomationRecorder::parameterCallback>(
-            *this);
-      }
-      else
-      {
-        dev->valueUpdated.disconnect<&AutomationRecorder::messageCallback>(
-            *this);
-      }
+      dev->internedValueUpdated
+          .disconnect<&AutomationRecorder::captureCallback>(*this);
     }
   }
   m_recordCallbackConnections.clear();
@@ -154,6 +153,9 @@ void AutomationRecorder::stop()
     return;
   }
 
+  // Values received since the last update
+  flush();
+
   auto simplify = m_settings.getSimplify();
   auto simplifyRatio = m_settings.getSimplificationRatio();
   // Add a last point corresponding to the current state
@@ -172,7 +174,8 @@ void AutomationRecorder::stop()
   for (const auto& recorded : numeric_records)
   {
     if (finish(
-            State::AddressAccessor{recorded.first, {}, recorded.second.unit},
+            State::AddressAccessor{
+                recorded.first.toAddress(), {}, recorded.second.unit},
             recorded.second, msecs, simplify, simplifyRatio))
       N++;
   }
@@ -181,7 +184,8 @@ void AutomationRecorder::stop()
   {
     for (int i = 0; i < 2; i++)
       if (finish(
-              make_address(recorded.first, i, recorded.second[i].unit),
+              make_address(
+                  recorded.first.toAddress(), i, recorded.second[i].unit),
               recorded.second[i], msecs, simplify, simplifyRatio))
         N++;
   }
@@ -190,7 +194,8 @@ void AutomationRecorder::stop()
   {
     for (int i = 0; i < 3; i++)
       if (finish(
-              make_address(recorded.first, i, recorded.second[i].unit),
+              make_address(
+                  recorded.first.toAddress(), i, recorded.second[i].unit),
               recorded.second[i], msecs, simplify, simplifyRatio))
         N++;
   }
@@ -199,7 +204,8 @@ void AutomationRecorder::stop()
   {
     for (int i = 0; i < 4; i++)
       if (finish(
-              make_address(recorded.first, i, recorded.second[i].unit),
+              make_address(
+                  recorded.first.toAddress(), i, recorded.second[i].unit),
               recorded.second[i], msecs, simplify, simplifyRatio))
         N++;
   }
@@ -210,37 +216,81 @@ void AutomationRecorder::stop()
   }
 }
 
-void AutomationRecorder::messageCallback(
-    const State::Address& addr, const ossia::value& val)
+void AutomationRecorder::captureCallback(
+    const State::InternedAddress& addr, const ossia::value& val)
 {
-  using namespace std::chrono;
-  if (context.started())
+  CapturedValue v{RecordContext::clock::now(), {}};
+
+  auto it = m_captures.find(addr);
+  if (it == m_captures.end() || !toCapturedValue(val, v))
+    return;
+
+  it->second->values.enqueue(v);
+
+  // The recording is started from the GUI thread, which reads the start time
+  if (!m_firstValue.exchange(true))
   {
-    val.apply(RecordAutomationSubsequentCallbackVisitor<MessagePolicy>{
-        *this, addr, context.time()});
+    QMetaObject::invokeMethod(
+        this,
+        [this, t = v.time] {
+          firstMessageReceived();
+          context.start(t);
+        },
+        Qt::QueuedConnection);
   }
+}
+
+void AutomationRecorder::flush()
+{
+  if (!context.started())
+    return;
+
+  if (m_recordingMode == Curve::Settings::Mode::Parameter)
+    flush_impl<ParameterPolicy>();
   else
-  {
-    firstMessageReceived();
-    context.start();
-    val.apply(RecordAutomationFirstCallbackVisitor{*this, addr});
-  }
+    flush_impl<MessagePolicy>();
 }
 
-void AutomationRecorder::parameterCallback(
-    const State::Address& addr, const ossia::value& val)
+template <typename RecordingPolicy>
+void AutomationRecorder::flush_impl()
 {
   using namespace std::chrono;
-  if (context.started())
+  const auto start = context.firstValueTime;
+
+  std::vector<const CaptureQueue*> updated;
+  for (const auto& p : m_captures)
   {
-    val.apply(RecordAutomationSubsequentCallbackVisitor<ParameterPolicy>{
-        *this, addr, context.time()});
+    CaptureQueue& queue = *p.second;
+    queue.drain(m_batch);
+    if (m_batch.empty())
+      continue;
+
+    updated.push_back(&queue);
+    for (const CapturedValue& v : m_batch)
+    {
+      const double msec
+          = duration_cast<microseconds>(v.time - start).count() / 1000.;
+      for (int i = 0; i < queue.components; i++)
+      {
+        const RecordData& proc = queue.data[i];
+        // The first value
+        if (msec <= 0.)
+          proc.segment.addPoint(0, v.value[i]);
+        else
+          RecordingPolicy{}(proc, msec, v.value[i]);
+      }
+    }
   }
-  else
+
+  const auto msecs = context.time();
+  for (const CaptureQueue* queue : updated)
   {
-    firstMessageReceived();
-    context.start();
-    val.apply(RecordAutomationFirstCallbackVisitor{*this, addr});
+    for (int i = 0; i < queue->components; i++)
+    {
+      auto& autom = *static_cast<Automation::ProcessModel*>(
+          queue->data[i].curveModel.parent());
+      autom.setDuration(msecs);
+    }
   }
 }
 
@@ -1,12 +1,18 @@
 #pragma once
 #include <Curve/Settings/CurveSettingsModel.hpp>
+#include <Recording/Record/CaptureQueue.hpp>
 #include <Recording/Record/RecordData.hpp>
 #include <Recording/Record/RecordProviderFactory.hpp>
 #include <Recording/Record/RecordTools.hpp>
 
+#include <State/InternedAddress.hpp>
+
 #include <score/tools/std/HashMap.hpp>
 
 #include <wobjectdefs.h>
+
+#include <atomic>
+#include <memory>
 namespace Curve
 {
 namespace Settings
@@ -33,18 +39,25 @@ public:
 
   void commit();
 
-  score::hash_map<State::Address, RecordData> numeric_records;
-  score::hash_map<State::Address, std::array<RecordData, 2>> vec2_records;
-  score::hash_map<State::Address, std::array<RecordData, 3>> vec3_records;
-  score::hash_map<State::Address, std::array<RecordData, 4>> vec4_records;
-  score::hash_map<State::Address, std::vector<RecordData>> list_records;
+  using key_type = State::InternedAddress;
+  score::hash_map<key_type, RecordData> numeric_records;
+  score::hash_map<key_type, std::array<RecordData, 2>> vec2_records;
+  score::hash_map<key_type, std::array<RecordData, 3>> vec3_records;
+  score::hash_map<key_type, std::array<RecordData, 4>> vec4_records;
+  score::hash_map<key_type, std::vector<RecordData>> list_records;
 
 public:
   void firstMessageReceived() W_SIGNAL(firstMessageReceived);
 
 private:
-  void messageCallback(const State::Address& addr, const ossia::value& val);
-  void parameterCallback(const State::Address& addr, const ossia::value& val);
+  // Called from the protocol threads
+  void
+  captureCallback(const State::InternedAddress& addr, const ossia::value& val);
+
+  // Called from the GUI thread: adds the captured values to the curves
+  void flush();
+  template <typename RecordingPolicy>
+  void flush_impl();
 
   bool finish(
       State::AddressAccessor addr, const RecordData& dat, const TimeVal& msecs,
@@ -53,6 +66,13 @@ private:
   Curve::Settings::Mode m_recordingMode{};
   std::vector<QPointer<Device::DeviceInterface>> m_recordCallbackConnections;
 
+  // Only modified in setup(), hence safe to read from any thread afterwards
+  score::hash_map<key_type, std::unique_ptr<CaptureQueue>> m_captures;
+  std::atomic_bool m_firstValue{};
+
+  // Values being added to the curves, kept to reuse its memory
+  std::vector<CapturedValue> m_batch;
+
   // TODO see this :
   // http://stackoverflow.com/questions/34596768/stdunordered-mapfind-using-a-type-different-than-the-key-type
 };
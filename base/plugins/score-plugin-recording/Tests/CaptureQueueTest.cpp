@@ -0,0 +1,82 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include <Recording/Record/CaptureQueue.hpp>
+
+#include <QObject>
+#include <QtTest/QtTest>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+class CaptureQueueTest : public QObject
+{
+  Q_OBJECT
+
+private Q_SLOTS:
+  void test_conversion()
+  {
+    Recording::CapturedValue v;
+    QVERIFY(Recording::toCapturedValue(ossia::value{2.5f}, v));
+    QCOMPARE(v.value[0], 2.5f);
+
+    QVERIFY(Recording::toCapturedValue(
+        ossia::value{std::array<float, 3>{1.f, 2.f, 3.f}}, v));
+    QCOMPARE(v.value[2], 3.f);
+
+    QVERIFY(!Recording::toCapturedValue(ossia::value{std::string{"x"}}, v));
+  }
+
+  // Several threads push the values of the same address while the GUI
+  // thread empties the queue: all the values must arrive, and the values
+  // of each thread in the order in which they were pushed.
+  void test_no_value_lost()
+  {
+    constexpr int producers = 4;
+    constexpr int count = 100000;
+
+    Recording::CaptureQueue queue{nullptr, 2};
+    std::atomic_int done{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < producers; p++)
+    {
+      threads.emplace_back([&, p] {
+        for (int i = 0; i < count; i++)
+        {
+          Recording::CapturedValue v{std::chrono::steady_clock::now(), {}};
+          v.value[0] = p;
+          v.value[1] = i;
+          queue.values.enqueue(v);
+        }
+        done++;
+      });
+    }
+
+    std::vector<int> next(producers, 0);
+    std::vector<Recording::CapturedValue> batch;
+    bool ordered = true;
+    auto consume = [&] {
+      queue.drain(batch);
+      for (const auto& v : batch)
+      {
+        const int p = v.value[0];
+        ordered &= (int(v.value[1]) == next[p]);
+        next[p]++;
+      }
+    };
+
+    while (done.load() < producers)
+      consume();
+    for (auto& t : threads)
+      t.join();
+    consume();
+
+    QVERIFY(ordered);
+    for (int p = 0; p < producers; p++)
+      QCOMPARE(next[p], count);
+  }
+};
+
+QTEST_APPLESS_MAIN(CaptureQueueTest)
+#include "CaptureQueueTest.moc"
@@ -21,7 +21,7 @@ namespace Scenario
 void DisplayedElementsModel::setSelection(const Selection& s)
 {
   ossia::for_each_in_tuple(elements(), [&](auto elt) {
-    elt->selection.set(s.contains(elt.data())); // OPTIMIZEME
+    elt->selection.update(s.contains(elt.data()));
   });
 }
 
@@ -27,6 +27,7 @@
 #include <Scenario/Document/ScenarioDocument/ScenarioDocumentModel.hpp>
 #include <Scenario/Document/ScenarioDocument/ScenarioDocumentView.hpp>
 #include <Scenario/Document/ScenarioDocument/ScenarioScene.hpp>
+#include <Scenario/Document/ScenarioDocument/SnapshotAction.hpp>
 #include <Scenario/Document/TimeRuler/TimeRuler.hpp>
 #include <Scenario/Settings/ScenarioSettingsModel.hpp>
 
@@ -169,6 +170,9 @@ ScenarioDocumentPresenter::ScenarioDocumentPresenter(
     view().timeBar().setPos(pctg * itv.defaultWidth() + itv.pos().x(), 0);
   });
 
+  auto widget = view().getWidget();
+  widget->addAction(new TimelineExportAction{model(), widget});
+
   setDisplayedInterval(model().baseInterval());
 
   model()
@@ -705,15 +709,15 @@ void ScenarioDocumentPresenter::on_viewModelFocused(
   }
 }
 
-void ScenarioDocumentPresenter::setNewSelection(const Selection& s)
+void ScenarioDocumentPresenter::setNewSelection(
+    const Selection& s, const SelectionDelta& delta)
 {
   static QMetaObject::Connection cur_proc_connection;
   auto process = m_focusManager.focusedModel();
 
-  // OPTIMIZEME
   for (auto& cable : model().cables)
   {
-    cable.selection.set(false);
+    cable.selection.update(false);
   }
 
   // Manages the selection (different case if we're
@@ -778,7 +782,11 @@ void ScenarioDocumentPresenter::setNewSelection(const Selection& s)
       }
       else
       {
-        newProc->setSelection(s);
+        // Within the same process, only the objects that changed are updated
+        if (newProc == process)
+          newProc->changeSelection(s, delta);
+        else
+          newProc->setSelection(s);
         if (process)
         {
           process->selection.set(false);
@@ -799,7 +807,7 @@ void ScenarioDocumentPresenter::setNewSelection(const Selection& s)
       {
         for (auto& cable : model().cables)
         {
-          cable.selection.set(s.contains(&cable));
+          cable.selection.update(s.contains(&cable));
         }
       }
     }
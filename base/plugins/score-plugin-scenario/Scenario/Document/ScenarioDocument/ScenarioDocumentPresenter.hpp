@@ -78,7 +78,8 @@ public:
   void setMillisPerPixel(ZoomRatio newFactor);
   void updateRect(const QRectF& rect);
 
-  void setNewSelection(const Selection& s) override;
+  void
+  setNewSelection(const Selection& s, const SelectionDelta& delta) override;
 
   void setDisplayedInterval(Scenario::IntervalModel& interval);
 
@@ -2,14 +2,23 @@
 // it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
 #include "SnapshotAction.hpp"
 
+#include <Scenario/Document/Interval/IntervalModel.hpp>
+#include <Scenario/Document/ScenarioDocument/ScenarioDocumentModel.hpp>
+#include <Scenario/Document/ScenarioDocument/TimelineRenderer.hpp>
+
 #include <QApplication>
 #include <QBuffer>
 #include <QClipboard>
 #include <QFile>
+#include <QFileDialog>
 #include <QGraphicsScene>
+#include <QInputDialog>
+#include <QMessageBox>
 #include <QMimeData>
 #include <QPainter>
 #include <QSvgGenerator>
+
+#include <algorithm>
 namespace Scenario
 {
 
@@ -54,4 +63,50 @@ void SnapshotAction::takeScreenshot(QGraphicsScene& scene)
   screenshot.write(b.buffer());
   screenshot.close();
 }
+
+TimelineExportAction::TimelineExportAction(
+    const ScenarioDocumentModel& model, QWidget* parent)
+    : QAction{tr("Export timeline"), parent}
+{
+  setShortcutContext(Qt::WidgetWithChildrenShortcut);
+  setShortcut(QKeySequence(Qt::SHIFT + Qt::Key_F10));
+
+  connect(this, &QAction::triggered, this, [&] { exportTimeline(model); });
+}
+
+void TimelineExportAction::exportTimeline(const ScenarioDocumentModel& model)
+{
+  auto parent = parentWidget();
+  const auto path = QFileDialog::getSaveFileName(
+      parent, tr("Export timeline"), {}, tr("Images (*.png *.svg)"));
+  if (path.isEmpty())
+    return;
+
+  // By default, ten pixels per second
+  const auto dur = model.baseInterval().duration.defaultDuration();
+  const int defaultWidth = std::clamp(int(dur.sec() * 10), 1920, 65536);
+
+  bool ok{};
+  const int w = QInputDialog::getInt(
+      parent, tr("Export timeline"), tr("Width (pixels)"), defaultWidth, 16,
+      1 << 20, 1, &ok);
+  if (!ok)
+    return;
+  const int h = QInputDialog::getInt(
+      parent, tr("Export timeline"), tr("Height (pixels)"), 1080, 16,
+      1 << 16, 1, &ok);
+  if (!ok)
+    return;
+
+  const TimelineRenderer renderer{model, w};
+  const bool saved = path.endsWith(".svg", Qt::CaseInsensitive)
+                         ? renderer.saveSvg(path, QSize{w, h})
+                         : renderer.savePng(path, QSize{w, h});
+  if (!saved)
+  {
+    QMessageBox::warning(
+        parent, tr("Export timeline"),
+        tr("Could not export the timeline to %1").arg(path));
+  }
+}
 }
@@ -3,6 +3,7 @@
 class QGraphicsScene;
 namespace Scenario
 {
+class ScenarioDocumentModel;
 struct SnapshotAction : public QAction
 {
 public:
@@ -11,4 +12,14 @@ public:
 private:
   void takeScreenshot(QGraphicsScene& scene);
 };
+
+//! Exports the whole timeline of the document as a PNG or SVG file
+struct TimelineExportAction : public QAction
+{
+public:
+  TimelineExportAction(const ScenarioDocumentModel& model, QWidget* parent);
+
+private:
+  void exportTimeline(const ScenarioDocumentModel& model);
+};
 }
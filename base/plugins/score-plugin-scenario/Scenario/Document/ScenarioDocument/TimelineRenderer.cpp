@@ -0,0 +1,313 @@
+// This is an open source non-commercial project. Dear PVS-Studio, please check
+// it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
+#include "TimelineRenderer.hpp"
+
+#include <Curve/Process/CurveProcessModel.hpp>
+#include <Process/Style/ScenarioStyle.hpp>
+#include <Scenario/Document/Event/EventModel.hpp>
+#include <Scenario/Document/Interval/IntervalModel.hpp>
+#include <Scenario/Document/ScenarioDocument/ScenarioDocumentModel.hpp>
+#include <Scenario/Document/State/StateModel.hpp>
+#include <Scenario/Document/TimeSync/TimeSyncModel.hpp>
+#include <Scenario/Process/ScenarioModel.hpp>
+
+#include <QFontDatabase>
+#include <QFontMetricsF>
+#include <QPainter>
+#include <QPolygonF>
+#include <QSvgGenerator>
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace Scenario
+{
+namespace
+{
+TimelineRenderer::Interval
+makeInterval(const IntervalModel& itv, double total, int width)
+{
+  TimelineRenderer::Interval res;
+  const double start = itv.date().msec();
+  const double dur = itv.duration.defaultDuration().msec();
+  res.start = start / total;
+  res.end = (start + dur) / total;
+  res.y = itv.heightPercentage();
+  res.color = itv.metadata().getColor().getBrush().color();
+  res.color.setAlphaF(1.0);
+  res.name = itv.metadata().getName();
+
+  if (dur <= 0)
+    return res;
+
+  // One sample every other pixel of the interval in the final image
+  const double samples = std::max(2., (res.end - res.start) * width / 2.);
+  for (const Process::ProcessModel& proc : itv.processes)
+  {
+    auto curve = dynamic_cast<const Curve::CurveProcessModel*>(&proc);
+    if (!curve || proc.duration().msec() <= 0)
+      continue;
+
+    // The curve spans the process, which may differ from the interval
+    const double scale = proc.duration().msec() / dur;
+
+    std::vector<const Curve::SegmentModel*> segts;
+    for (const Curve::SegmentModel& seg : curve->curve().segments())
+      segts.push_back(&seg);
+    std::sort(segts.begin(), segts.end(), [](auto lhs, auto rhs) {
+      return lhs->start().x() < rhs->start().x();
+    });
+
+    TimelineRenderer::CurveSummary c;
+    for (auto seg : segts)
+    {
+      const double x0 = seg->start().x();
+      const double x1 = seg->end().x();
+      const int n = std::max(2, int((x1 - x0) * scale * samples));
+      for (int i = 0; i < n; i++)
+      {
+        const double x = x0 + (x1 - x0) * i / (n - 1);
+        c.points.emplace_back(x * scale, seg->valueAt(x));
+      }
+    }
+    res.curves.push_back(std::move(c));
+  }
+  return res;
+}
+
+const Scenario::ProcessModel* baseScenario(const IntervalModel& itv)
+{
+  for (const Process::ProcessModel& proc : itv.processes)
+  {
+    if (auto s = dynamic_cast<const Scenario::ProcessModel*>(&proc))
+      return s;
+  }
+  return nullptr;
+}
+}
+
+TimelineRenderer::TimelineRenderer(
+    const ScenarioDocumentModel& model, int width)
+{
+  auto& skin = Process::Style::instance();
+  m_background = skin.Background.getBrush().color();
+  m_state = skin.StateDot.getBrush().color();
+  m_timeSync = skin.TimenodeDefault.getBrush().color();
+
+  const auto& base = model.baseInterval();
+  const double total = base.duration.defaultDuration().msec();
+  if (total <= 0)
+    return;
+
+  auto scenario = baseScenario(base);
+  if (!scenario)
+  {
+    m_intervals.push_back(makeInterval(base, total, width));
+    return;
+  }
+
+  m_intervals.reserve(scenario->intervals.size());
+  for (const IntervalModel& itv : scenario->intervals)
+    m_intervals.push_back(makeInterval(itv, total, width));
+
+  m_states.reserve(scenario->states.size());
+  for (const StateModel& st : scenario->states)
+  {
+    const auto& ev = scenario->event(st.eventId());
+    m_states.push_back({ev.date().msec() / total, st.heightPercentage()});
+  }
+
+  m_timeSyncs.reserve(scenario->timeSyncs.size());
+  for (const TimeSyncModel& ts : scenario->timeSyncs)
+  {
+    TimeSync res{ts.date().msec() / total, 1., 0.};
+    for (const auto& ev_id : ts.events())
+    {
+      for (const auto& st_id : scenario->event(ev_id).states())
+      {
+        const double y = scenario->state(st_id).heightPercentage();
+        res.top = std::min(res.top, y);
+        res.bottom = std::max(res.bottom, y);
+      }
+    }
+
+    if (res.top <= res.bottom)
+      m_timeSyncs.push_back(res);
+  }
+}
+
+void TimelineRenderer::paint(QPainter& p, QSize size, QRect rect) const
+{
+  p.fillRect(rect, m_background);
+
+  const double w = size.width();
+  const double h = size.height();
+
+  // Sizes relative to a 1080 pixels high image
+  const double unit = std::max(1., h / 1080.);
+  const double radius = 4. * unit;
+  const double band = 24. * unit;
+  const double margin = 20. * unit;
+
+  const auto x_of = [&](double d) { return d * w; };
+  const auto y_of = [&](double y) { return margin + y * (h - 2 * margin); };
+  const auto visible = [&](double x0, double x1) {
+    return x1 >= rect.left() - radius && x0 <= rect.right() + radius;
+  };
+
+  QFont font = p.font();
+  font.setPointSizeF(8. * unit);
+  p.setFont(font);
+  const QFontMetricsF metrics{font};
+
+  QPen pen;
+  pen.setCapStyle(Qt::FlatCap);
+
+  // Time syncs
+  pen.setColor(m_timeSync);
+  pen.setWidthF(unit);
+  p.setPen(pen);
+  for (const TimeSync& ts : m_timeSyncs)
+  {
+    const double x = x_of(ts.date);
+    if (!visible(x, x))
+      continue;
+    p.drawLine(
+        QPointF{x, y_of(ts.top) - 2 * radius},
+        QPointF{x, y_of(ts.bottom) + 2 * radius});
+  }
+
+  // Intervals, with their name and the summary of their curves below
+  for (const Interval& itv : m_intervals)
+  {
+    const double x0 = x_of(itv.start);
+    const double x1 = x_of(itv.end);
+    if (!visible(x0, x1))
+      continue;
+
+    const double y = y_of(itv.y);
+    pen.setColor(itv.color);
+    pen.setWidthF(2. * unit);
+    p.setPen(pen);
+    p.drawLine(QPointF{x0, y}, QPointF{x1, y});
+
+    // Elided so that it never crosses the end of the interval, whatever
+    // the tile which paints it.
+    const auto name
+        = metrics.elidedText(itv.name, Qt::ElideRight, x1 - x0 - radius);
+    if (!name.isEmpty())
+      p.drawText(QPointF{x0 + radius, y - radius}, name);
+
+    if (itv.curves.empty() || x1 <= x0)
+      continue;
+
+    pen.setWidthF(unit);
+    p.setPen(pen);
+    p.save();
+    p.setClipRect(QRectF{x0, y, x1 - x0, band + radius}, Qt::IntersectClip);
+    const double top = y + radius;
+
+    // Only the points around the painted part of the interval
+    const double from = (rect.left() - radius - x0) / (x1 - x0);
+    const double to = (rect.right() + radius - x0) / (x1 - x0);
+    for (const CurveSummary& c : itv.curves)
+    {
+      auto first = std::lower_bound(
+          c.points.begin(), c.points.end(), from,
+          [](const QPointF& pt, double x) { return pt.x() < x; });
+      auto last = std::upper_bound(
+          first, c.points.end(), to,
+          [](double x, const QPointF& pt) { return x < pt.x(); });
+      if (first != c.points.begin())
+        --first;
+      if (last != c.points.end())
+        ++last;
+
+      QPolygonF poly;
+      poly.reserve(std::distance(first, last));
+      for (auto it = first; it != last; ++it)
+        poly.push_back(
+            {x0 + it->x() * (x1 - x0), top + (1. - it->y()) * band});
+      p.drawPolyline(poly);
+    }
+    p.restore();
+  }
+
+  // States
+  p.setPen(Qt::NoPen);
+  p.setBrush(m_state);
+  for (const State& st : m_states)
+  {
+    const double x = x_of(st.date);
+    if (!visible(x, x))
+      continue;
+    p.drawEllipse(QPointF{x, y_of(st.y)}, radius, radius);
+  }
+}
+
+QImage TimelineRenderer::renderImage(QSize size, int tileWidth) const
+{
+  QImage img{size, QImage::Format_ARGB32_Premultiplied};
+  if (img.isNull() || tileWidth <= 0)
+    return img;
+
+  // Each tile paints directly in its own columns of the image,
+  // so that the threads never write to the same memory.
+  uchar* const bits = img.bits();
+  const int stride = img.bytesPerLine();
+  const int tiles = (size.width() + tileWidth - 1) / tileWidth;
+
+  std::atomic_int next{0};
+  auto work = [&] {
+    for (int t = next++; t < tiles; t = next++)
+    {
+      const int x = t * tileWidth;
+      const int w = std::min(tileWidth, size.width() - x);
+      QImage tile{bits + x * 4, w, size.height(), stride, img.format()};
+
+      QPainter p{&tile};
+      p.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing);
+      p.translate(-x, 0);
+      paint(p, size, QRect{x, 0, w, size.height()});
+    }
+  };
+
+  // Text can only be drawn outside of the GUI thread on some platforms
+  const int n = QFontDatabase::supportsThreadedFontRendering()
+                    ? std::min(
+                        tiles,
+                        std::max(1, (int)std::thread::hardware_concurrency()))
+                    : 1;
+  std::vector<std::thread> threads;
+  threads.reserve(n - 1);
+  for (int i = 1; i < n; i++)
+    threads.emplace_back(work);
+  work();
+  for (auto& t : threads)
+    t.join();
+
+  return img;
+}
+
+bool TimelineRenderer::savePng(const QString& path, QSize size) const
+{
+  const auto img = renderImage(size);
+  return !img.isNull() && img.save(path, "PNG");
+}
+
+bool TimelineRenderer::saveSvg(const QString& path, QSize size) const
+{
+  QSvgGenerator gen;
+  gen.setFileName(path);
+  gen.setSize(size);
+  gen.setViewBox(QRect{QPoint{}, size});
+
+  QPainter p;
+  if (!p.begin(&gen))
+    return false;
+  p.setRenderHints(QPainter::Antialiasing | QPainter::TextAntialiasing);
+  paint(p, size, QRect{QPoint{}, size});
+  return p.end();
+}
+}
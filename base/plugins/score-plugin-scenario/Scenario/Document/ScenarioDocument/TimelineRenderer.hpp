@@ -0,0 +1,86 @@
+#pragma once
+#include <QColor>
+#include <QImage>
+#include <QPointF>
+#include <QString>
+
+#include <score_plugin_scenario_export.h>
+
+#include <vector>
+
+class QPainter;
+namespace Scenario
+{
+class ScenarioDocumentModel;
+
+/**
+ * @brief Renders the whole timeline of a document, away from the live scene
+ *
+ * The live scene only lays out the items of the displayed part of the
+ * document, and rendering it repaints each of them on the GUI thread.
+ * Here the model is instead copied once, on the GUI thread, into a flat
+ * snapshot of intervals, states, time syncs and curve summaries. The
+ * snapshot is then painted without accessing the model nor the scene:
+ * as vertical tiles in parallel for images, or in a single pass for SVG.
+ *
+ * All the coordinates of the snapshot are normalized: dates are in
+ * [0, 1] of the document's duration, heights in [0, 1] of the scenario.
+ */
+class SCORE_PLUGIN_SCENARIO_EXPORT TimelineRenderer
+{
+public:
+  struct CurveSummary
+  {
+    //! x in [0, 1] of the interval, y in [0, 1]
+    std::vector<QPointF> points;
+  };
+
+  struct Interval
+  {
+    double start{};
+    double end{};
+    double y{};
+    QColor color;
+    QString name;
+    std::vector<CurveSummary> curves;
+  };
+
+  struct State
+  {
+    double date{};
+    double y{};
+  };
+
+  struct TimeSync
+  {
+    double date{};
+    double top{};
+    double bottom{};
+  };
+
+  //! Copies the model. Must be called from the GUI thread.
+  //! The curves are sampled for an image of the given width.
+  TimelineRenderer(const ScenarioDocumentModel& model, int width);
+
+  //! Paints the part of the timeline in rect, the whole timeline being
+  //! of the given size. Can be called from any thread.
+  void paint(QPainter& p, QSize size, QRect rect) const;
+
+  //! Renders the timeline in tiles of tileWidth pixels, on all the cores
+  //! if the platform can render text outside of the GUI thread, and in the
+  //! calling thread otherwise.
+  QImage renderImage(QSize size, int tileWidth = 512) const;
+
+  bool savePng(const QString& path, QSize size) const;
+  bool saveSvg(const QString& path, QSize size) const;
+
+private:
+  std::vector<Interval> m_intervals;
+  std::vector<State> m_states;
+  std::vector<TimeSync> m_timeSyncs;
+
+  QColor m_background;
+  QColor m_state;
+  QColor m_timeSync;
+};
+}
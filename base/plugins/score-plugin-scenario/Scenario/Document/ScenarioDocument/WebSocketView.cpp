@@ -2,15 +2,50 @@
 // it. PVS-Studio Static Code Analyzer for C, C++ and C#: http://www.viva64.com
 #include "WebSocketView.hpp"
 
+#include <QBuffer>
+#include <QDataStream>
+#include <QElapsedTimer>
+#include <QPainter>
 #include <QtCore/QDebug>
 
+#include <wobjectimpl.h>
+
+#include <cstring>
+W_OBJECT_IMPL(WebSocketView)
+
+namespace
+{
+static constexpr int frame_width = 1024;
+static constexpr int frame_height = 768;
+static constexpr int tile_size = 128;
+static constexpr quint16 protocol_version = 1;
+
+template <typename F>
+void for_each_tile(const QRegion& region, F&& f)
+{
+  const QRect frame{0, 0, frame_width, frame_height};
+  for (int y = 0; y < frame_height; y += tile_size)
+  {
+    for (int x = 0; x < frame_width; x += tile_size)
+    {
+      const QRect tile = QRect{x, y, tile_size, tile_size} & frame;
+      if (region.intersects(tile))
+        f(tile);
+    }
+  }
+}
+}
+
 WebSocketView::WebSocketView(QGraphicsScene* s, quint16 port, QObject* parent)
     : QObject(parent)
     , m_pWebSocketServer(new QWebSocketServer(
           QStringLiteral("Echo Server"), QWebSocketServer::NonSecureMode,
           this))
     , m_scene{s}
+    , m_frame{frame_width, frame_height, QImage::Format_ARGB32_Premultiplied}
 {
+  m_frame.fill(Qt::transparent);
+
   if (m_pWebSocketServer->listen(QHostAddress::Any, port))
   {
     if (m_debug)
@@ -22,12 +57,30 @@ WebSocketView::WebSocketView(QGraphicsScene* s, quint16 port, QObject* parent)
         m_pWebSocketServer, &QWebSocketServer::closed, this,
         &WebSocketView::closed);
   }
+
+  connect(
+      m_scene, &QGraphicsScene::changed, this,
+      &WebSocketView::on_sceneChanged);
+  connect(
+      m_scene, &QGraphicsScene::sceneRectChanged, this,
+      [=](const QRectF&) { updateTransform(); });
+  updateTransform();
+
+  m_timer.setInterval(1000 / m_fps);
+  connect(&m_timer, &QTimer::timeout, this, &WebSocketView::sendFrame);
 }
 
 WebSocketView::~WebSocketView()
 {
   m_pWebSocketServer->close();
   qDeleteAll(m_clients.begin(), m_clients.end());
+  qDeleteAll(m_newClients.begin(), m_newClients.end());
+}
+
+void WebSocketView::setMaxFrameRate(int fps)
+{
+  m_fps = qBound(1, fps, 60);
+  m_timer.setInterval(1000 / m_fps);
 }
 
 void WebSocketView::onNewConnection()
@@ -44,33 +97,23 @@ void WebSocketView::onNewConnection()
       pSocket, &QWebSocket::disconnected, this,
       &WebSocketView::socketDisconnected);
 
-  m_clients << pSocket;
+  // It will get a keyframe on the next tick
+  m_newClients << pSocket;
+  if (!m_timer.isActive())
+    m_timer.start();
 }
 
-#include <QBuffer>
-#include <QPainter>
-#include <QSvgGenerator>
 void WebSocketView::processTextMessage(QString message)
 {
   QWebSocket* pClient = qobject_cast<QWebSocket*>(sender());
   if (m_debug)
     qDebug() << "Message received:" << message;
-  if (pClient)
-  {
 
-    QBuffer b;
-    QSvgGenerator p;
-    p.setOutputDevice(&b);
-    p.setSize(QSize(1024, 768));
-    p.setViewBox(QRect(0, 0, 1024, 768));
-    QPainter painter;
-    painter.begin(&p);
-    painter.setRenderHints(
-        QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
-    m_scene->render(&painter);
-    painter.end();
-
-    pClient->sendTextMessage(b.buffer());
+  // Any text message is a request for a keyframe, e.g. after
+  // the client lost track of the frames.
+  if (pClient && m_clients.removeAll(pClient) > 0)
+  {
+    m_newClients << pClient;
   }
 }
 
@@ -93,6 +136,154 @@ void WebSocketView::socketDisconnected()
   if (pClient)
   {
     m_clients.removeAll(pClient);
+    m_newClients.removeAll(pClient);
     pClient->deleteLater();
   }
 }
+
+void WebSocketView::on_sceneChanged(const QList<QRectF>& rects)
+{
+  const QRect frame{0, 0, frame_width, frame_height};
+  for (const auto& rect : rects)
+  {
+    // One more pixel on each side for antialiasing
+    m_damage += m_transform.mapRect(rect).toAlignedRect().adjusted(-1, -1, 1, 1)
+                & frame;
+  }
+}
+
+void WebSocketView::updateTransform()
+{
+  // Same placement than QGraphicsScene::render with Qt::KeepAspectRatio
+  const auto sr = m_scene->sceneRect();
+  m_transform = QTransform{};
+  if (sr.width() > 0. && sr.height() > 0.)
+  {
+    const qreal s
+        = std::min(frame_width / sr.width(), frame_height / sr.height());
+    m_transform.translate(
+        (frame_width - sr.width() * s) / 2.,
+        (frame_height - sr.height() * s) / 2.);
+    m_transform.scale(s, s);
+    m_transform.translate(-sr.left(), -sr.top());
+  }
+
+  m_damage = QRect{0, 0, frame_width, frame_height};
+}
+
+QRegion WebSocketView::render(const QRegion& damage)
+{
+  QRegion changed;
+  const auto inverse = m_transform.inverted();
+
+  QImage tile_img{tile_size, tile_size, QImage::Format_ARGB32_Premultiplied};
+  for_each_tile(damage, [&](const QRect& tile) {
+    tile_img.fill(Qt::transparent);
+    {
+      QPainter painter{&tile_img};
+      painter.setRenderHints(
+          QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
+      painter.translate(-tile.topLeft());
+      painter.setTransform(m_transform, true);
+
+      const QRectF source = inverse.mapRect(QRectF{tile});
+      m_scene->render(&painter, source, source, Qt::IgnoreAspectRatio);
+    }
+
+    // Only keep the tiles whose pixels changed since the last frame
+    const int line_bytes = tile.width() * 4;
+    bool different = false;
+    for (int y = 0; y < tile.height(); y++)
+    {
+      const uchar* src = tile_img.constScanLine(y);
+      uchar* dst = m_frame.scanLine(tile.y() + y) + tile.x() * 4;
+      if (different || std::memcmp(src, dst, line_bytes) != 0)
+      {
+        different = true;
+        std::memcpy(dst, src, line_bytes);
+      }
+    }
+
+    if (different)
+      changed += tile;
+  });
+
+  return changed;
+}
+
+QByteArray WebSocketView::encode(const QRegion& tiles, bool keyframe)
+{
+  std::vector<QRect> rects;
+  for_each_tile(tiles, [&](const QRect& tile) { rects.push_back(tile); });
+
+  QByteArray msg;
+  QDataStream stream{&msg, QIODevice::WriteOnly};
+  stream.setByteOrder(QDataStream::LittleEndian);
+  stream.writeRawData("SCRV", 4);
+  stream << protocol_version << quint16(frame_width) << quint16(frame_height)
+         << quint16(tile_size) << m_frameIndex << quint8(keyframe)
+         << quint16(rects.size());
+
+  QByteArray png;
+  for (const auto& tile : rects)
+  {
+    png.clear();
+    {
+      QBuffer buf{&png};
+      buf.open(QIODevice::WriteOnly);
+      m_frame.copy(tile).save(&buf, "PNG");
+    }
+
+    stream << quint16(tile.x()) << quint16(tile.y()) << quint16(tile.width())
+           << quint16(tile.height()) << quint32(png.size());
+    stream.writeRawData(png.constData(), png.size());
+  }
+
+  return msg;
+}
+
+void WebSocketView::sendFrame()
+{
+  if (m_clients.isEmpty() && m_newClients.isEmpty())
+  {
+    // Damage keeps being accumulated until someone connects
+    m_timer.stop();
+    return;
+  }
+
+  QElapsedTimer timer;
+  timer.start();
+  qint64 bytes = 0;
+
+  if (!m_damage.isEmpty())
+  {
+    const QRegion changed = render(m_damage);
+    m_damage = QRegion{};
+
+    if (!changed.isEmpty() && !m_clients.isEmpty())
+    {
+      // Encoded once, shared by all the clients
+      const QByteArray msg = encode(changed, false);
+      for (auto client : m_clients)
+        client->sendBinaryMessage(msg);
+      bytes += msg.size();
+      m_frameIndex++;
+    }
+  }
+
+  if (!m_newClients.isEmpty())
+  {
+    const QByteArray msg
+        = encode(QRegion{0, 0, frame_width, frame_height}, true);
+    for (auto client : m_newClients)
+      client->sendBinaryMessage(msg);
+    bytes += msg.size();
+
+    m_clients += m_newClients;
+    m_newClients.clear();
+  }
+
+  if (m_debug && bytes > 0)
+    qDebug() << "WebSocketView: frame" << m_frameIndex << ":" << bytes
+             << "bytes in" << timer.elapsed() << "ms";
+}
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <QGraphicsScene>
+#include <QImage>
+#include <QRegion>
+#include <QTimer>
+#include <QTransform>
 #include <QtCore/QByteArray>
 #include <QtCore/QList>
 #include <QtCore/QObject>
@@ -9,6 +13,22 @@
 
 #include <wobjectdefs.h>
 
+/**
+ * @brief Streams the scene to remote clients.
+ *
+ * The scene is rendered in a fixed-size frame, split in square tiles.
+ * The regions of the scene which changed are accumulated between two frames;
+ * at each frame (at most maxFrameRate() per second) only the tiles they cover
+ * are re-rendered, and those whose pixels actually changed are encoded in PNG.
+ * The resulting message is built once and pushed to every client.
+ *
+ * Message layout (binary, little endian) :
+ * - "SCRV" magic, u16 version, u16 frame width, u16 frame height,
+ *   u16 tile size, u32 frame index, u8 keyframe, u16 tile count
+ * - for each tile : u16 x, u16 y, u16 width, u16 height, u32 size, PNG data
+ *
+ * A newly connected client receives a keyframe with every tile.
+ */
 class WebSocketView final : public QObject
 {
   W_OBJECT(WebSocketView)
@@ -17,6 +37,12 @@ public:
       QGraphicsScene* s, quint16 port, QObject* parent = Q_NULLPTR);
   ~WebSocketView();
 
+  void setMaxFrameRate(int fps);
+  int maxFrameRate() const noexcept
+  {
+    return m_fps;
+  }
+
 public:
   void closed() W_SIGNAL(closed);
 
@@ -31,8 +57,22 @@ public:
   W_SLOT(socketDisconnected);
 
 private:
+  void on_sceneChanged(const QList<QRectF>& rects);
+  void updateTransform();
+  void sendFrame();
+  QRegion render(const QRegion& damage);
+  QByteArray encode(const QRegion& tiles, bool keyframe);
+
   QWebSocketServer* m_pWebSocketServer;
   QGraphicsScene* m_scene{};
   QList<QWebSocket*> m_clients;
-  bool m_debug;
+  QList<QWebSocket*> m_newClients;
+
+  QTimer m_timer;
+  QImage m_frame;
+  QTransform m_transform;
+  QRegion m_damage;
+  quint32 m_frameIndex{};
+  int m_fps{20};
+  bool m_debug{false};
 };
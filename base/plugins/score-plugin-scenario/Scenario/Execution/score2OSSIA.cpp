@@ -6,6 +6,7 @@
 #include <Scenario/Execution/score2OSSIA.hpp>
 
 #include <ossia/dataflow/execution_state.hpp>
+#include <ossia/detail/algorithms.hpp>
 #include <ossia/detail/apply.hpp>
 #include <ossia/editor/expression/expression.hpp>
 #include <ossia/editor/expression/expression_atom.hpp>
@@ -14,6 +15,7 @@
 #include <ossia/editor/expression/expression_pulse.hpp>
 #include <ossia/editor/state/message.hpp>
 #include <ossia/editor/state/state.hpp>
+#include <ossia/network/base/node_functions.hpp>
 #include <ossia/network/value/value.hpp>
 
 class NodeNotFoundException : public std::runtime_error
@@ -57,23 +59,45 @@ message(const State::Message& mess, const ossia::execution_state& deviceList)
   return {};
 }
 
+// The message tree is walked along the tree of its device, so that each
+// node is found from its parent instead of building its whole address and
+// looking it up from the device list.
+static void addMessages(
+    ossia::state& s, const Process::MessageNode& n,
+    ossia::net::node_base& node)
+{
+  if (const auto& val = n.value(); val && val->valid())
+  {
+    if (auto param = node.get_parameter())
+    {
+      const auto& qual = n.name.qualifiers.get();
+      s.add(ossia::message{{*param, qual.accessors}, *val, qual.unit});
+    }
+  }
+
+  for (const auto& child : n)
+  {
+    if (auto child_node
+        = ossia::net::find_node(node, child.name.name.toStdString()))
+      addMessages(s, child, *child_node);
+  }
+}
+
 void state(
     ossia::state& parent, const Scenario::StateModel& score_state,
     const Execution::Context& ctx)
 {
-  auto& elts = parent;
-
-  // For all elements where IOType != Invalid,
-  // we add the elements to the state.
-
-  auto& dl = *ctx.execState;
-  score_state.messages().rootNode().visit([&](const auto& n) {
-    const auto& val = n.value();
-    if (val)
-    {
-      elts.add(message(State::Message{Process::address(n), *val}, dl));
-    }
-  });
+  // The children of the root are the devices : the messages end up grouped
+  // by device in the state.
+  auto& devs = ctx.execState->edit_devices();
+  for (const auto& dev_node : score_state.messages().rootNode())
+  {
+    const auto name = dev_node.name.name.toStdString();
+    auto dev = ossia::find_if(
+        devs, [&](const auto& d) { return d->get_name() == name; });
+    if (dev != devs.end())
+      addMessages(parent, dev_node, (*dev)->get_root_node());
+  }
 
   /* TODO
   for (auto& proc : score_state.stateProcesses)
@@ -18,6 +18,7 @@
 #include <QLineEdit>
 #include <QMenu>
 #include <QPushButton>
+#include <QSignalBlocker>
 #include <QSize>
 #include <QToolButton>
 #include <QWidgetAction>
@@ -57,6 +58,7 @@ MetadataWidget::MetadataWidget(
     , m_descriptionWidget{this}
     , m_descriptionLay{&m_descriptionWidget}
     , m_labelLine{metadata.getLabel(), this}
+    , m_remoteControl{this}
     , m_comments{metadata.getComment(), this}
     , m_colorButton{this}
     , m_cmtBtn{this}
@@ -73,6 +75,13 @@ MetadataWidget::MetadataWidget(
   con(metadata, &score::ModelMetadata::LabelChanged, this,
       [=](const auto& str) { m_labelLine.setText(str); });
 
+  // Exposed in the local tree even when it is lazy
+  m_remoteControl.setToolTip(
+      tr("Always create the parameters of this element in the local tree"));
+  m_descriptionLay.addRow(tr("Remote control"), &m_remoteControl);
+  con(m_remoteControl, &QCheckBox::toggled, this,
+      [=](bool b) { remoteControlChanged(b); });
+
   // color
   m_colorButton.setArrowType(Qt::NoArrow);
   m_colorButton.setToolButtonStyle(Qt::ToolButtonIconOnly);
@@ -178,6 +187,13 @@ void MetadataWidget::updateAsked()
 {
   m_labelLine.setText(m_metadata.getLabel());
   m_comments.setText(m_metadata.getComment());
+  {
+    QSignalBlocker block{m_remoteControl};
+    m_remoteControl.setChecked(
+        m_metadata.getExtendedMetadata()
+            .value(QStringLiteral("RemoteControl"))
+            .toBool());
+  }
   // m_meta.update(m_metadata.getExtendedMetadata());
 
   m_colorButtonPixmap.fill(m_metadata.getColor().getBrush().color());
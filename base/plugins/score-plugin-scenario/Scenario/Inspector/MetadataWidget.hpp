@@ -13,6 +13,7 @@
 #include <score/widgets/MarginLess.hpp>
 #include <score/widgets/TextLabel.hpp>
 
+#include <QCheckBox>
 #include <QColor>
 #include <QFormLayout>
 #include <QLineEdit>
@@ -82,6 +83,18 @@ public:
                 new ChangeElementColor<T>{model, newColor});
         });
 
+    connect(this, &MetadataWidget::remoteControlChanged, [&](bool b) {
+      auto meta = model.metadata().getExtendedMetadata();
+      if (meta.value(QStringLiteral("RemoteControl")).toBool() == b)
+        return;
+
+      if (b)
+        meta.insert(QStringLiteral("RemoteControl"), true);
+      else
+        meta.remove(QStringLiteral("RemoteControl"));
+      m_commandDispatcher.submit(new SetExtendedMetadata<T>{model, meta});
+    });
+
     /*
     connect(
         this, &MetadataWidget::extendedMetadataChanged,
@@ -99,6 +112,7 @@ public:
   void labelChanged(QString arg) W_SIGNAL(labelChanged, arg);
   void commentsChanged(QString arg) W_SIGNAL(commentsChanged, arg);
   void colorChanged(score::ColorRef arg) W_SIGNAL(colorChanged, arg);
+  void remoteControlChanged(bool arg) W_SIGNAL(remoteControlChanged, arg);
   void extendedMetadataChanged(const QVariantMap& arg)
       W_SIGNAL(extendedMetadataChanged, arg);
 
@@ -116,6 +130,7 @@ private:
   QWidget m_descriptionWidget;
   score::MarginLess<QFormLayout> m_descriptionLay;
   QLineEdit m_labelLine;
+  QCheckBox m_remoteControl;
   CommentEdit m_comments;
   QToolButton m_colorButton;
   QToolButton m_cmtBtn;
@@ -48,6 +48,38 @@
 W_OBJECT_IMPL(Scenario::ObjectItemModel)
 namespace Scenario
 {
+namespace
+{
+std::vector<const Process::ProcessModel*>
+processList(const score::EntityMap<Process::ProcessModel>& procs)
+{
+  std::vector<const Process::ProcessModel*> res;
+  res.reserve(procs.size());
+  for (auto& p : procs)
+    res.push_back(&p);
+  return res;
+}
+
+int processRow(const Process::ProcessModel& proc)
+{
+  const score::EntityMap<Process::ProcessModel>* procs{};
+  if (auto itv = qobject_cast<Scenario::IntervalModel*>(proc.parent()))
+    procs = &itv->processes;
+  else if (auto st = qobject_cast<Scenario::StateModel*>(proc.parent()))
+    procs = &st->stateProcesses;
+  else
+    return -1;
+
+  int row = 0;
+  for (auto& p : *procs)
+  {
+    if (&p == &proc)
+      return row;
+    row++;
+  }
+  return -1;
+}
+}
 
 ObjectItemModel::ObjectItemModel(
     const score::DocumentContext& ctx, QObject* parent)
@@ -112,16 +144,45 @@ void ObjectItemModel::setSelected(QList<const IdentifiedObjectAbstract*> objs)
     }
   }
 
-  root = root.toSet().toList();
-  if (root != m_root)
+  const auto new_root = root.toSet();
+  if (new_root != m_root.toSet())
   {
     cleanConnections();
 
-    beginResetModel();
-    m_root = root;
-    endResetModel();
+    // The objects which stay selected keep their rows, and thus their
+    // expansion state in the views.
+    for (int i = m_root.size() - 1; i >= 0; i--)
+    {
+      if (!new_root.contains(m_root[i]))
+      {
+        beginRemoveRows({}, i, i);
+        m_root.removeAt(i);
+        endRemoveRows();
+      }
+    }
+
+    const auto old_root = m_root.toSet();
+    QList<const QObject*> added;
+    for (auto obj : new_root)
+    {
+      if (!old_root.contains(obj))
+        added.push_back(obj);
+    }
 
-    setupConnections();
+    if (!added.empty())
+    {
+      // The new objects must be known before the views look at their
+      // children
+      const int first = m_root.size();
+      beginInsertRows({}, first, first + added.size() - 1);
+      m_root.append(added);
+      setupConnections();
+      endInsertRows();
+    }
+    else
+    {
+      setupConnections();
+    }
   }
 }
 
@@ -131,17 +192,49 @@ void ObjectItemModel::setupConnections()
     return;
   m_aliveMap.clear();
 
+  auto watchState = [this](const Scenario::StateModel& s) {
+    m_aliveMap.insert(&s, &s);
+    m_processes[&s] = processList(s.stateProcesses);
+    s.stateProcesses.added.connect<&ObjectItemModel::on_processAdded>(*this);
+    s.stateProcesses.removing
+        .connect<&ObjectItemModel::on_processRemoving>(*this);
+    s.stateProcesses.removed.connect<&ObjectItemModel::on_processRemoved>(
+        *this);
+    s.stateProcesses.orderChanged
+        .connect<&ObjectItemModel::on_processesReordered>(*this);
+
+    for (const auto& sp : s.stateProcesses)
+      m_aliveMap.insert(&sp, &sp);
+  };
+
+  auto watchEvent = [=](const Scenario::EventModel& e) {
+    auto& scenar = Scenario::parentScenario(e);
+    m_aliveMap.insert(&e, &e);
+    m_states[&e] = e.states();
+    m_itemCon.push_back(con(e, &EventModel::statesChanged, this, [=, &e] {
+      on_statesChanged(e);
+    }));
+
+    for (const auto& st : e.states())
+    {
+      if (auto* sptr = scenar.findState(st))
+        watchState(*sptr);
+    }
+  };
+
   for (auto obj : m_root)
   {
     m_aliveMap.insert(obj, obj);
     if (auto cst = qobject_cast<const Scenario::IntervalModel*>(obj))
     {
-      cst->processes.added
-          .connect<&ObjectItemModel::recompute<const Process::ProcessModel&>>(
-              *this);
-      cst->processes.removed
-          .connect<&ObjectItemModel::recompute<const Process::ProcessModel&>>(
-              *this);
+      m_processes[cst] = processList(cst->processes);
+      cst->processes.added.connect<&ObjectItemModel::on_processAdded>(*this);
+      cst->processes.removing.connect<&ObjectItemModel::on_processRemoving>(
+          *this);
+      cst->processes.removed.connect<&ObjectItemModel::on_processRemoved>(
+          *this);
+      cst->processes.orderChanged
+          .connect<&ObjectItemModel::on_processesReordered>(*this);
 
       for (auto& proc : cst->processes)
         m_aliveMap.insert(&proc, &proc);
@@ -149,85 +242,41 @@ void ObjectItemModel::setupConnections()
     else if (auto tn = qobject_cast<const Scenario::TimeSyncModel*>(obj))
     {
       auto& scenar = Scenario::parentScenario(*tn);
-      m_itemCon.push_back(
-          connect(tn, &TimeSyncModel::newEvent, this, [=] { recompute(); }));
+      m_events[tn] = tn->events();
       m_itemCon.push_back(connect(
-          tn, &TimeSyncModel::eventRemoved, this, [=] { recompute(); }));
+          tn, &TimeSyncModel::newEvent, this, [=] { on_eventsChanged(*tn); }));
+      m_itemCon.push_back(connect(tn, &TimeSyncModel::eventRemoved, this, [=] {
+        on_eventsChanged(*tn);
+      }));
 
       for (const auto& ev : tn->events())
       {
         if (auto* eptr = scenar.findEvent(ev))
-        {
-          m_aliveMap.insert(eptr, eptr);
-          m_itemCon.push_back(connect(
-              eptr, &EventModel::statesChanged, this, [=] { recompute(); }));
-          for (const auto& st : eptr->states())
-          {
-            if (auto* sptr = scenar.findState(st))
-            {
-              m_aliveMap.insert(sptr, sptr);
-              sptr->stateProcesses.added.connect<
-                  &ObjectItemModel::recompute<const Process::ProcessModel&>>(
-                  *this);
-              sptr->stateProcesses.removed.connect<
-                  &ObjectItemModel::recompute<const Process::ProcessModel&>>(
-                  *this);
-
-              for (const auto& sp : sptr->stateProcesses)
-                m_aliveMap.insert(&sp, &sp);
-            }
-          }
-        }
+          watchEvent(*eptr);
       }
     }
     else if (auto ev = qobject_cast<const Scenario::EventModel*>(obj))
     {
-      auto& scenar = Scenario::parentScenario(*ev);
-      auto& e = *ev;
-      m_aliveMap.insert(&e, &e);
-      m_itemCon.push_back(
-          con(e, &EventModel::statesChanged, this, [=] { recompute(); }));
-
-      for (const auto& st : e.states())
-      {
-        if (auto* sptr = scenar.findState(st))
-        {
-          m_aliveMap.insert(sptr, sptr);
-          sptr->stateProcesses.added.connect<
-              &ObjectItemModel::recompute<const Process::ProcessModel&>>(
-              *this);
-          sptr->stateProcesses.removed.connect<
-              &ObjectItemModel::recompute<const Process::ProcessModel&>>(
-              *this);
-
-          for (const auto& sp : sptr->stateProcesses)
-            m_aliveMap.insert(&sp, &sp);
-        }
-      }
+      watchEvent(*ev);
     }
     else if (auto st = qobject_cast<const Scenario::StateModel*>(obj))
     {
-      auto& s = *st;
-      m_aliveMap.insert(&s, &s);
-      s.stateProcesses.added
-          .connect<&ObjectItemModel::recompute<const Process::ProcessModel&>>(
-              *this);
-      s.stateProcesses.removed
-          .connect<&ObjectItemModel::recompute<const Process::ProcessModel&>>(
-              *this);
-
-      for (const auto& sp : s.stateProcesses)
-        m_aliveMap.insert(&sp, &sp);
+      watchState(*st);
     }
 
     m_itemCon.push_back(connect(obj, &QObject::destroyed, this, [=] {
-      m_root.removeOne(obj);
+      const int row = m_root.indexOf(obj);
+      if (row == -1)
+        return;
+
       cleanConnections();
 
-      beginResetModel();
-      endResetModel();
+      beginRemoveRows({}, row, row);
+      m_root.removeAt(row);
+      endRemoveRows();
 
       setupConnections();
+      changed();
     }));
   }
 }
@@ -239,21 +288,206 @@ void ObjectItemModel::cleanConnections()
   for (auto& con : m_itemCon)
     QObject::disconnect(con);
   m_itemCon.clear();
+  m_events.clear();
+  m_states.clear();
+  m_processes.clear();
+}
+
+QModelIndex ObjectItemModel::indexOf(const QObject* obj) const
+{
+  const int root = m_root.indexOf(obj);
+  if (root != -1)
+    return createIndex(root, 0, (void*)obj);
+
+  if (auto ev = qobject_cast<const Scenario::EventModel*>(obj))
+  {
+    auto& scenar = Scenario::parentScenario(*ev);
+    auto& tn = Scenario::parentTimeSync(*ev, scenar);
+    auto events = m_events.find(&tn);
+    if (!m_root.contains(&tn) || events == m_events.end())
+      return QModelIndex{};
+
+    auto it = ossia::find(*events, ev->id());
+    if (it == events->end())
+      return QModelIndex{};
+    return createIndex(std::distance(events->begin(), it), 0, (void*)obj);
+  }
+  else if (auto st = qobject_cast<const Scenario::StateModel*>(obj))
+  {
+    auto& scenar = Scenario::parentScenario(*st);
+    auto& ev = Scenario::parentEvent(*st, scenar);
+    auto states = m_states.find(&ev);
+    if (states == m_states.end() || !indexOf(&ev).isValid())
+      return QModelIndex{};
+
+    auto it = ossia::find(*states, st->id());
+    if (it == states->end())
+      return QModelIndex{};
+    return createIndex(std::distance(states->begin(), it), 0, (void*)obj);
+  }
+  else if (auto proc = qobject_cast<const Process::ProcessModel*>(obj))
+  {
+    auto procs = m_processes.find(proc->parent());
+    if (procs == m_processes.end() || !indexOf(proc->parent()).isValid())
+      return QModelIndex{};
+
+    auto it = ossia::find(*procs, proc);
+    if (it == procs->end())
+      return QModelIndex{};
+    return createIndex(std::distance(procs->begin(), it), 0, (void*)obj);
+  }
+
+  return QModelIndex{};
+}
+
+void ObjectItemModel::on_processAdded(const Process::ProcessModel& proc)
+{
+  m_aliveMap.insert(&proc, &proc);
+
+  // The process is already in its parent, but the views keep seeing the
+  // previous processes until they are notified.
+  auto procs = m_processes.find(proc.parent());
+  const auto parent = indexOf(proc.parent());
+  const int row = processRow(proc);
+  if (procs == m_processes.end() || !parent.isValid() || row == -1)
+    return;
+
+  const int pos = std::min(row, int(procs->size()));
+  beginInsertRows(parent, pos, pos);
+  procs->insert(procs->begin() + pos, &proc);
+  endInsertRows();
+  changed();
+}
+
+void ObjectItemModel::on_processRemoving(const Process::ProcessModel& proc)
+{
+  auto procs = m_processes.find(proc.parent());
+  const auto parent = indexOf(proc.parent());
+  if (procs == m_processes.end() || !parent.isValid())
+    return;
+
+  auto it = ossia::find(*procs, &proc);
+  if (it == procs->end())
+    return;
+
+  const int row = std::distance(procs->begin(), it);
+  beginRemoveRows(parent, row, row);
+  procs->erase(it);
+  endRemoveRows();
+  changed();
+}
+
+void ObjectItemModel::on_processRemoved(const Process::ProcessModel& proc)
+{
+  m_aliveMap.remove(&proc);
+}
+
+void ObjectItemModel::on_processesReordered()
+{
+  layoutAboutToBeChanged();
+  for (auto it = m_processes.begin(); it != m_processes.end(); ++it)
+  {
+    if (auto itv = qobject_cast<const IntervalModel*>(it.key()))
+      *it = processList(itv->processes);
+    else if (auto st = qobject_cast<const StateModel*>(it.key()))
+      *it = processList(st->stateProcesses);
+  }
+
+  for (const auto& idx : persistentIndexList())
+  {
+    auto obj = (QObject*)idx.internalPointer();
+    if (!isAlive(obj))
+      continue;
+
+    if (auto proc = qobject_cast<Process::ProcessModel*>(obj))
+    {
+      const auto moved = indexOf(proc);
+      changePersistentIndex(
+          idx, moved.isValid() ? createIndex(moved.row(), idx.column(), obj)
+                               : QModelIndex{});
+    }
+  }
+  layoutChanged();
+  changed();
+}
+
+template <typename Vec>
+void ObjectItemModel::updateRows(
+    const QModelIndex& parent, Vec& shown, const Vec& current)
+{
+  for (int i = int(shown.size()) - 1; i >= 0; i--)
+  {
+    if (ossia::find(current, shown[i]) == current.end())
+    {
+      beginRemoveRows(parent, i, i);
+      shown.erase(shown.begin() + i);
+      endRemoveRows();
+    }
+  }
+
+  for (int i = 0; i < int(current.size()); i++)
+  {
+    if (ossia::find(shown, current[i]) == shown.end())
+    {
+      beginInsertRows(parent, i, i);
+      shown.insert(shown.begin() + i, current[i]);
+      endInsertRows();
+    }
+  }
+}
+
+void ObjectItemModel::on_eventsChanged(const TimeSyncModel& tn)
+{
+  auto it = m_events.find(&tn);
+  const auto parent = indexOf(&tn);
+  if (it == m_events.end() || !parent.isValid())
+    return;
+
+  // Watch the new events before the views look at them. The views keep
+  // seeing the previous events until they are notified, row by row.
+  const auto shown = *it;
+  cleanConnections();
+  setupConnections();
+
+  auto& rows = m_events[&tn];
+  rows = shown;
+  updateRows(parent, rows, tn.events());
+  changed();
+}
+
+void ObjectItemModel::on_statesChanged(const EventModel& ev)
+{
+  auto it = m_states.find(&ev);
+  const auto parent = indexOf(&ev);
+  if (it == m_states.end() || !parent.isValid())
+    return;
+
+  // Watch the new states before the views look at them. The views keep
+  // seeing the previous states until they are notified, row by row.
+  const auto shown = *it;
+  cleanConnections();
+  setupConnections();
+
+  auto& rows = m_states[&ev];
+  rows = shown;
+  updateRows(parent, rows, ev.states());
+  changed();
 }
 
 QModelIndex
 ObjectItemModel::index(int row, int column, const QModelIndex& parent) const
 {
+  // The children are the ones last notified to the views, which may differ
+  // from the ones of the model while a change is being notified.
   auto sel = (QObject*)parent.internalPointer();
   if (isAlive(sel))
   {
-    if (auto cst = qobject_cast<Scenario::IntervalModel*>(sel))
+    if (qobject_cast<Scenario::IntervalModel*>(sel))
     {
-      if (row < (int)cst->processes.size())
+      auto procs = m_processes.find(sel);
+      if (procs != m_processes.end() && row < (int)procs->size())
       {
-        auto it = cst->processes.begin();
-        std::advance(it, row);
-        return createIndex(row, column, &*(it));
+        return createIndex(row, column, (void*)(*procs)[row]);
       }
       else
       {
@@ -263,12 +497,10 @@ ObjectItemModel::index(int row, int column, const QModelIndex& parent) const
     else if (auto ev = qobject_cast<Scenario::EventModel*>(sel))
     {
       Scenario::ScenarioInterface& scenar = Scenario::parentScenario(*ev);
-      if (row < (int)ev->states().size())
+      auto states = m_states.find(sel);
+      if (states != m_states.end() && row < (int)states->size())
       {
-        auto it = ev->states().begin();
-        std::advance(it, row);
-
-        if (auto st = scenar.findState(*it))
+        if (auto st = scenar.findState((*states)[row]))
           return createIndex(row, column, st);
       }
       else
@@ -279,12 +511,10 @@ ObjectItemModel::index(int row, int column, const QModelIndex& parent) const
     else if (auto tn = qobject_cast<Scenario::TimeSyncModel*>(sel))
     {
       Scenario::ScenarioInterface& scenar = Scenario::parentScenario(*tn);
-      if (row < (int)tn->events().size())
+      auto events = m_events.find(sel);
+      if (events != m_events.end() && row < (int)events->size())
       {
-        auto it = tn->events().begin();
-        std::advance(it, row);
-
-        if (auto ev = scenar.findEvent(*it))
+        if (auto ev = scenar.findEvent((*events)[row]))
           return createIndex(row, column, ev);
       }
       else
@@ -292,14 +522,12 @@ ObjectItemModel::index(int row, int column, const QModelIndex& parent) const
         qWarning("TN: wrong size! ");
       }
     }
-    else if (auto st = qobject_cast<Scenario::StateModel*>(sel))
+    else if (qobject_cast<Scenario::StateModel*>(sel))
     {
-      if (row < (int)st->stateProcesses.size())
+      auto procs = m_processes.find(sel);
+      if (procs != m_processes.end() && row < (int)procs->size())
       {
-        auto it = st->stateProcesses.begin();
-        std::advance(it, row);
-        auto& proc = *it;
-        return createIndex(row, column, &proc);
+        return createIndex(row, column, (void*)(*procs)[row]);
       }
       else
       {
@@ -346,59 +574,30 @@ QModelIndex ObjectItemModel::parent(const QModelIndex& child) const
   if (!isAlive(sel))
     return QModelIndex{};
 
-  if (qobject_cast<Scenario::IntervalModel*>(sel))
+  if (qobject_cast<Scenario::IntervalModel*>(sel)
+      || qobject_cast<Scenario::TimeSyncModel*>(sel))
   {
     return QModelIndex{};
   }
   else if (auto ev = qobject_cast<Scenario::EventModel*>(sel))
   {
-    Scenario::ScenarioInterface& scenar = Scenario::parentScenario(*ev);
-    auto& tn = Scenario::parentTimeSync(*ev, scenar);
-    auto idx = m_root.indexOf(&tn);
-    if (idx >= 0)
-      return createIndex(idx, 0, (void*)m_root[idx]);
-    else
+    if (m_root.contains(ev))
       return QModelIndex{};
-  }
-  else if (qobject_cast<Scenario::TimeSyncModel*>(sel))
-  {
-    return QModelIndex{};
+
+    Scenario::ScenarioInterface& scenar = Scenario::parentScenario(*ev);
+    return indexOf(&Scenario::parentTimeSync(*ev, scenar));
   }
   else if (auto st = qobject_cast<Scenario::StateModel*>(sel))
   {
-    Scenario::ScenarioInterface& scenar = Scenario::parentScenario(*st);
-    auto& tn = Scenario::parentTimeSync(*st, scenar);
-    auto it = ossia::find(tn.events(), st->eventId());
-    SCORE_ASSERT(it != tn.events().end());
-    auto idx = std::distance(tn.events().begin(), it);
-    if (idx >= 0)
-      return createIndex(idx, 0, (void*)&Scenario::parentEvent(*st, scenar));
-    else
+    if (m_root.contains(st))
       return QModelIndex{};
+
+    Scenario::ScenarioInterface& scenar = Scenario::parentScenario(*st);
+    return indexOf(&Scenario::parentEvent(*st, scenar));
   }
-  else if (auto stp = qobject_cast<Process::ProcessModel*>(sel))
+  else if (auto proc = qobject_cast<Process::ProcessModel*>(sel))
   {
-    if (auto state = qobject_cast<Scenario::StateModel*>(stp->parent()))
-    {
-      Scenario::ScenarioInterface& scenar = Scenario::parentScenario(*state);
-      auto& ev = Scenario::parentEvent(*state, scenar);
-      auto it = ossia::find(ev.states(), state->id());
-      SCORE_ASSERT(it != ev.states().end());
-      auto idx = std::distance(ev.states().begin(), it);
-
-      if (idx >= 0)
-        return createIndex(idx, 0, state);
-      else
-        return QModelIndex{};
-    }
-    else if (auto cst = qobject_cast<Scenario::IntervalModel*>(stp->parent()))
-    {
-      auto idx = m_root.indexOf(cst);
-      if (idx >= 0)
-        return createIndex(idx, 0, (void*)m_root[idx]);
-      else
-        return QModelIndex{};
-    }
+    return indexOf(proc->parent());
   }
 
   return QModelIndex{};
@@ -426,21 +625,21 @@ int ObjectItemModel::rowCount(const QModelIndex& parent) const
   auto sel = (QObject*)parent.internalPointer();
   if (isAlive(sel))
   {
-    if (auto cst = qobject_cast<Scenario::IntervalModel*>(sel))
+    if (qobject_cast<Scenario::IntervalModel*>(sel)
+        || qobject_cast<Scenario::StateModel*>(sel))
     {
-      return cst->processes.size();
+      auto procs = m_processes.find(sel);
+      return procs != m_processes.end() ? int(procs->size()) : 0;
     }
-    else if (auto ev = qobject_cast<Scenario::EventModel*>(sel))
+    else if (qobject_cast<Scenario::EventModel*>(sel))
     {
-      return ev->states().size();
+      auto states = m_states.find(sel);
+      return states != m_states.end() ? int(states->size()) : 0;
     }
-    else if (auto ts = qobject_cast<Scenario::TimeSyncModel*>(sel))
+    else if (qobject_cast<Scenario::TimeSyncModel*>(sel))
     {
-      return ts->events().size();
-    }
-    else if (auto st = qobject_cast<Scenario::StateModel*>(sel))
-    {
-      return st->stateProcesses.size();
+      auto events = m_events.find(sel);
+      return events != m_events.end() ? int(events->size()) : 0;
     }
     else
     {
@@ -1011,16 +1210,17 @@ void ObjectPanelDelegate::on_modelChanged(
     m_lay->addWidget(m_searchWidget);
     m_lay->addWidget(m_objects);
 
-    setNewSelection(stack.currentSelection());
+    const auto& sel = stack.currentSelection();
+    setNewSelection(sel, SelectionDelta{Selection{}, sel});
   }
 }
 
-void ObjectPanelDelegate::setNewSelection(const Selection& sel)
+void ObjectPanelDelegate::setNewSelection(
+    const Selection& sel, const SelectionDelta& delta)
 {
   if (m_objects)
   {
     m_objects->model.setSelected(sel.toList());
-    m_objects->expandAll();
 
     auto cur_sel = document()->selectionStack.currentSelection();
     auto idx = m_objects->model.index(0, 0, {});
@@ -1067,7 +1267,18 @@ ObjectWidget::ObjectWidget(const score::DocumentContext& ctx, QWidget* par)
   setMouseTracking(true);
   setDragDropMode(QAbstractItemView::DragDrop);
 
-  con(model, &ObjectItemModel::changed, this, &QTreeView::expandAll);
+  con(model, &QAbstractItemModel::rowsInserted, this,
+      &ObjectWidget::expandRows);
+}
+
+void ObjectWidget::expandRows(const QModelIndex& parent, int first, int last)
+{
+  for (int row = first; row <= last; row++)
+  {
+    const auto idx = model.index(row, 0, parent);
+    expand(idx);
+    expandRows(idx, 0, model.rowCount(idx) - 1);
+  }
 }
 
 void ObjectWidget::selectionChanged(
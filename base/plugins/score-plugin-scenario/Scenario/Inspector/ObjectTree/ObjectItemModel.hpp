@@ -1,4 +1,7 @@
 #pragma once
+#include <Scenario/Document/Event/EventModel.hpp>
+#include <Scenario/Document/TimeSync/TimeSyncModel.hpp>
+
 #include <score/document/DocumentContext.hpp>
 #include <score/plugins/panel/PanelDelegate.hpp>
 #include <score/plugins/panel/PanelDelegateFactory.hpp>
@@ -9,6 +12,7 @@
 
 #include <QAbstractItemModel>
 #include <QContextMenuEvent>
+#include <QHash>
 #include <QHeaderView>
 #include <QLabel>
 #include <QLineEdit>
@@ -17,15 +21,24 @@
 #include <QTreeView>
 #include <QVBoxLayout>
 
+#include <score_plugin_scenario_export.h>
 #include <wobjectdefs.h>
+
+#include <vector>
 class QToolButton;
 class QGraphicsSceneMouseEvent;
+namespace Process
+{
+class ProcessModel;
+}
 namespace Scenario
 {
 // TimeSync / event / state / state processes
 // or
 // Interval / processes
-class ObjectItemModel final : public QAbstractItemModel, public Nano::Observer
+class SCORE_PLUGIN_SCENARIO_EXPORT ObjectItemModel final
+    : public QAbstractItemModel,
+      public Nano::Observer
 {
   W_OBJECT(ObjectItemModel)
 public:
@@ -66,22 +79,33 @@ private:
 
   bool isAlive(QObject* obj) const;
 
-  template <typename... Args>
-  void recompute(Args&&...)
-  {
-    beginResetModel();
-    cleanConnections();
+  //! Index of an object shown in the tree, or an invalid index
+  QModelIndex indexOf(const QObject* obj) const;
 
-    setupConnections();
-    endResetModel();
+  // The changes of the children are forwarded to the views row by row
+  void on_processAdded(const Process::ProcessModel& proc);
+  void on_processRemoving(const Process::ProcessModel& proc);
+  void on_processRemoved(const Process::ProcessModel& proc);
+  void on_processesReordered();
+  void on_eventsChanged(const TimeSyncModel& tn);
+  void on_statesChanged(const EventModel& ev);
 
-    changed();
-  }
+  //! Removes and inserts the rows of the ids which changed, updating the
+  //! children shown between the notifications of each row
+  template <typename Vec>
+  void updateRows(const QModelIndex& parent, Vec& shown, const Vec& current);
 
   QList<const QObject*> m_root;
   QMetaObject::Connection m_con;
   mutable QMap<const QObject*, QPointer<const QObject>> m_aliveMap;
 
+  // Children as last notified to the views: the model answers from them,
+  // so that they only change between the begin and end of a row change.
+  QHash<const QObject*, TimeSyncModel::EventIdVec> m_events;
+  QHash<const QObject*, EventModel::StateIdVec> m_states;
+  QHash<const QObject*, std::vector<const Process::ProcessModel*>>
+      m_processes;
+
   const score::DocumentContext& m_ctx;
   std::vector<QMetaObject::Connection> m_itemCon;
 };
@@ -99,6 +123,9 @@ private:
       const QItemSelection& selected,
       const QItemSelection& deselected) override;
 
+  //! New rows are expanded, the others keep their state
+  void expandRows(const QModelIndex& parent, int first, int last);
+
   void contextMenuEvent(QContextMenuEvent* ev) override;
   const score::DocumentContext& m_ctx;
 };
@@ -192,7 +219,8 @@ private:
 
   void on_modelChanged(
       score::MaybeDocument oldm, score::MaybeDocument newm) override;
-  void setNewSelection(const Selection& sel) override;
+  void setNewSelection(
+      const Selection& sel, const SelectionDelta& delta) override;
 
   SizePolicyWidget* m_widget{};
   QVBoxLayout* m_lay{};
@@ -221,13 +221,33 @@ Selection ProcessModel::selectedChildren() const noexcept
 
 void ProcessModel::setSelection(const Selection& s) const noexcept
 {
-  // OPTIMIZEME
   apply([&](auto&& m) {
     for (auto& elt : this->*m)
-      elt.selection.set(s.contains(&elt));
+      elt.selection.update(s.contains(&elt));
   });
 }
 
+void ProcessModel::changeSelection(
+    const Selection&, const SelectionDelta& delta) const noexcept
+{
+  auto update = [&](const Selection& objects, bool selected) {
+    for (const auto& obj : objects)
+    {
+      if (!obj || obj->parent() != this)
+        continue;
+
+      apply([&](auto&& m) {
+        using element_type =
+            typename std::remove_reference_t<decltype(this->*m)>::value_type;
+        if (auto elt = qobject_cast<const element_type*>(obj.data()))
+          elt->selection.update(selected);
+      });
+    }
+  };
+  update(delta.removed, false);
+  update(delta.added, true);
+}
+
 const QVector<Id<IntervalModel>> intervalsBeforeTimeSync(
     const Scenario::ProcessModel& scenar, const Id<TimeSyncModel>& timeSyncId)
 {
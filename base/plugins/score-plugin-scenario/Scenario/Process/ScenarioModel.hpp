@@ -179,6 +179,8 @@ public:
 
 private:
   void setSelection(const Selection& s) const noexcept override;
+  void changeSelection(
+      const Selection& s, const SelectionDelta& delta) const noexcept override;
   bool event(QEvent* e) override
   {
     return QObject::event(e);